@@ -1,21 +1,31 @@
-#include <cstdio>
-#include <iostream>
-#include <cstdlib>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
 
 #include "../HAL/MPU9250_HAL.hpp"
-#include "../Service/MPU9250_Service.hpp"
+#include "../Services/MPU9250_Service.hpp"
+#include "../Services/MPU9250_Telemetry.hpp"
 
 #define MPU9250_BAUD_RATE   400000
+#define TELEMETRY_BAUD_RATE 115200
+#define SAMPLE_PERIOD_MS    100
+#define RETRY_DELAY_MS      5
 
-int main() 
+/* Static line buffer: no heap, no stream state */
+static char lineBuffer[96];
+
+static void logLine(TelemetryWriter &out, const char *msg)
 {
-    stdio_init_all();
+    TelemetryLine line(lineBuffer, sizeof(lineBuffer));
+    out.writeLine(line.text(msg));
+}
 
-    sleep_ms(200); // wait for USB serial
+int main() 
+{
+    /* Only the telemetry UART is brought up; nothing here goes through stdio */
+    TelemetryWriter telemetry(uart_default);
+    telemetry.begin(PICO_DEFAULT_UART_TX_PIN, TELEMETRY_BAUD_RATE);
 
-    std::cout<<"Start Pico W MPU9250 Sensor... \n";
+    logLine(telemetry, "Start Pico W MPU9250 Sensor... \n");
 
     // Edit common layer to hal, service with configuration file, 
     MPU9250_HAL imu9250_hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
@@ -26,22 +36,12 @@ int main()
     {
         if(imu9250_hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, MPU9250_BAUD_RATE))
         {
-            std::cout<<"MPU9250 Connected successfully^^\n";
+            logLine(telemetry, "MPU9250 Connected successfully^^\n");
             break;
         } 
-        std::cout<<"MPU9250 Connected Failed!\n";
-        sleep_ms(500);
-    } while (1);
-
-    do
-    {
-        if(imu9250_hal.initMPU9250())
-        {
-            std::cout<<"MPU9250 Init successfully^^\n";
-            break;
-        } 
-        std::cout<<"MPU9250 Configuration Failed!\n";
-        sleep_ms(500);
+        logLine(telemetry, "MPU9250 Connected Failed!\n");
+        telemetry.service();
+        sleep_ms(RETRY_DELAY_MS);
     } while (1);
 
     /*
@@ -49,40 +49,68 @@ int main()
     {
         if(imu9250_hal.initAK8963())
         {
-            std::cout<<"AK8963 Init successfully^^\n";
+            logLine(telemetry, "AK8963 Init successfully^^\n");
             break;
         } 
-        printf("AK8963 Configuration Failed!\n");
+        logLine(telemetry, "AK8963 Configuration Failed!\n");
         sleep_ms(500);
     } while (1);
     */
 
+    /* IMUService::begin() runs the HAL init state machine (reset + config) exactly once */
     do
     {
         if(imu9250.begin())
         {
-            std::cout<<"MPU9250 begin successfully^^\n";
+            logLine(telemetry, "MPU9250 begin successfully^^\n");
             break;
         } 
-        std::cout<<"MPU9250 begin Failed!\n";
-        sleep_ms(500);
+        logLine(telemetry, "MPU9250 begin Failed!\n");
+        telemetry.service();
+        sleep_ms(RETRY_DELAY_MS);
     } while (1);
 
-    std::cout<<"Initialization complete.\n\n";
+    TelemetryLine initLine(lineBuffer, sizeof(lineBuffer));
+    initLine.text("Initialization complete in ").integer((int32_t)imu9250_hal.initDuration_us()).text(" us.\n\n");
+    telemetry.writeLine(initLine);
+
+    bool firstReported = false;
 
     while (true)
     {
+        absolute_time_t next = make_timeout_time_ms(SAMPLE_PERIOD_MS);
 
-        AccelData acc = imu9250.getAccelerometer();
-        GyroData  gyr = imu9250.getGyroscope();
-        TempData  tmp = imu9250.getTemperature();
+        /* One planned 14-byte burst instead of three separate reads */
+        IMUData   all = imu9250.getAll();
+        AccelData acc = all.accel;
+        GyroData  gyr = all.gyro;
+        TempData  tmp = all.temp;
         //MagData   mag = imu.getMagnetometer();
 
+        TelemetryLine line(lineBuffer, sizeof(lineBuffer));
+        if (!firstReported && (imu9250.timeToFirstSample_us() != 0))
+        {
+            line.text("First sample at ").integer((int32_t)imu9250.timeToFirstSample_us()).text(" us after boot\n");
+            telemetry.writeLine(line);
+            line.clear();
+            firstReported = true;
+        }
+
+        line.text("Acc(g): ").fixed(acc.x_g, 4).text("   ").fixed(acc.y_g, 4).text("   ").fixed(acc.z_g, 4).newline();
+        telemetry.writeLine(line);
+
+        line.clear().text("GYR(dPS)(g): ").fixed(gyr.x_dps, 3).text("   ").fixed(gyr.y_dps, 3).text("   ").fixed(gyr.z_dps, 3).newline();
+        telemetry.writeLine(line);
 
-        std::cout<<"Acc(g): "<<acc.x_g<<"   "<<acc.y_g<<"   "<<acc.z_g<<std::endl;
-        std::cout<<"GYR(dPS)(g): "<<gyr.x_dps<<"   "<<gyr.y_dps<<"   "<<gyr.z_dps<<std::endl;
-        std::cout<<"TEMP(C): "<<tmp.temperature_c<<std::endl;
-        sleep_ms(100);
+        line.clear().text("TEMP(C): ").fixed(tmp.temperature_c, 2).newline();
+        telemetry.writeLine(line);
+
+        /* Drain the UART between samples instead of sleeping */
+        while (!time_reached(next))
+        {
+            telemetry.service();
+            tight_loop_contents();
+        }
     }
 
     return 0;
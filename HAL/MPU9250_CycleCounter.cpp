@@ -0,0 +1,66 @@
+#include "MPU9250_CycleCounter.hpp"
+#include "hardware/structs/systick.h"
+
+namespace
+{
+    /* SysTick CSR bits */
+    constexpr uint32_t CSR_ENABLE    = 1u << 0;
+    constexpr uint32_t CSR_TICKINT   = 1u << 1;
+    constexpr uint32_t CSR_CLKSOURCE = 1u << 2;  // processor clock
+}
+
+CycleCounter::CycleCounter()
+: running_(false), restore_(false), savedCsr_(0), savedRvr_(0)
+{ }
+
+CycleCounter::~CycleCounter()
+{
+    stop();
+}
+
+bool CycleCounter::start()
+{
+    if(running_)
+    {
+        return true;
+    }
+
+    const uint32_t csr = systick_hw->csr;
+    if((csr & CSR_ENABLE) != 0)
+    {
+        /* Someone else's SysTick: usable only if it already is what we would program */
+        const uint32_t wanted = CSR_ENABLE | CSR_CLKSOURCE;
+        if(((csr & (CSR_ENABLE | CSR_TICKINT | CSR_CLKSOURCE)) != wanted) || (systick_hw->rvr != CYCLE_COUNTER_MASK))
+        {
+            return false;
+        }
+        restore_ = false;
+        running_ = true;
+        return true;
+    }
+
+    savedCsr_ = csr;
+    savedRvr_ = systick_hw->rvr;
+    systick_hw->rvr = CYCLE_COUNTER_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = CSR_ENABLE | CSR_CLKSOURCE;
+    restore_ = true;
+    running_ = true;
+    return true;
+}
+
+void CycleCounter::stop()
+{
+    if(running_ && restore_)
+    {
+        systick_hw->csr = savedCsr_;
+        systick_hw->rvr = savedRvr_;
+    }
+    running_ = false;
+    restore_ = false;
+}
+
+uint32_t CycleCounter::read() const
+{
+    return running_ ? systick_hw->cvr : 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file : MPU9250_CycleCounter.hpp
+ * @brief: SysTick-based CPU cycle counter for profiling on the RP2040.
+ *
+ * SysTick is a single core-local timer that the SDK, an RTOS or the
+ * application may already own. A CycleCounter only takes it over for the
+ * duration of a measurement: start() saves the current configuration and
+ * sets SysTick free running on the processor clock, stop() puts the saved
+ * configuration back. A SysTick that is already in use is left alone and
+ * start() reports it.
+ *
+ * @author :[Sara Saad , Hager Shohieb]
+ * @version:1.0
+ * @date   :December 01, 2025
+ *
+ **/
+
+#ifndef MPU9250_CYCLE_COUNTER_HPP
+#define MPU9250_CYCLE_COUNTER_HPP
+
+/* ************************************** Include Part **************************************** */
+/* cstdint: Standard integer types.*/
+#include <cstdint>
+/* ******************************************************************************************** */
+
+/* SysTick counts down over 24 bits: measured spans must stay below 2^24 cycles */
+constexpr uint32_t CYCLE_COUNTER_MASK = 0x00FFFFFFu;
+
+/**
+ * @class :CycleCounter
+ * @brief :Claims SysTick as a free-running cycle counter and restores it afterwards.
+ */
+class CycleCounter
+{
+    public:
+    CycleCounter();
+
+    /**
+     * @brief :Release SysTick if still claimed.
+     */
+    ~CycleCounter();
+
+    /**
+     * @brief :Start counting processor cycles.
+     * 
+     * An idle SysTick is saved and reprogrammed. One already free running on
+     * the processor clock over 24 bits without its interrupt is shared as is.
+     * Any other configuration belongs to someone else and is not touched.
+     * 
+     * @return :true if counting, false if SysTick is in use with another configuration.
+     */
+    bool start();
+
+    /**
+     * @brief :Stop counting and restore the SysTick configuration found by start().
+     */
+    void stop();
+
+    /**
+     * @brief :true between a successful start() and stop().
+     */
+    bool running() const { return running_; }
+
+    /**
+     * @brief :Current counter value (counts down); 0 when not running.
+     */
+    uint32_t read() const;
+
+    /**
+     * @brief :Cycles between two read() values taken in that order.
+     */
+    static uint32_t elapsed(uint32_t first, uint32_t second) { return (first - second) & CYCLE_COUNTER_MASK; }
+
+    private:
+    bool     running_;
+    bool     restore_;   // SysTick was reprogrammed by start() and is put back by stop()
+    uint32_t savedCsr_;
+    uint32_t savedRvr_;
+};
+
+#endif // MPU9250_CYCLE_COUNTER_HPP
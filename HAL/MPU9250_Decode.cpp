@@ -0,0 +1,416 @@
+#include "MPU9250_Decode.hpp"
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    inline int16_t be16(const uint8_t* p)
+    {
+        return (int16_t)((p[0] << 8) | p[1]);
+    }
+
+    inline int16_t le16(const uint8_t* p)
+    {
+        return (int16_t)((p[1] << 8) | p[0]);
+    }
+
+    /* Scalar tail shared by every kernel: frames [first, frames) */
+    void decodeTail(const uint8_t* bytes, size_t first, size_t frames, const FrameColumns& out)
+    {
+        for (size_t f = first; f < frames; f++)
+        {
+            const uint8_t* p = bytes + f * MPU9250_FRAME_BYTES;
+            for (uint8_t c = FRAME_ACCEL_X; c <= FRAME_GYRO_Z; c++)
+            {
+                out.channel[c][f] = be16(p + 2 * c);
+            }
+        }
+    }
+
+    void decodeTail9(const uint8_t* bytes, size_t first, size_t frames, const FrameColumns& out)
+    {
+        for (size_t f = first; f < frames; f++)
+        {
+            const uint8_t* p = bytes + f * MPU9250_FRAME9_BYTES;
+            for (uint8_t c = FRAME_ACCEL_X; c <= FRAME_GYRO_Z; c++)
+            {
+                out.channel[c][f] = be16(p + 2 * c);
+            }
+            /* AK8963 data is little-endian */
+            for (uint8_t c = FRAME_MAG_X; c <= FRAME_MAG_Z; c++)
+            {
+                out.channel[c][f] = le16(p + 2 * c);
+            }
+        }
+    }
+
+#if defined(__SSE2__)
+    /* Swap bytes in the first `swapped` 16-bit lanes, leave the rest as they are */
+    inline __m128i swap16(__m128i v, int swapped)
+    {
+#if defined(__SSSE3__)
+        const __m128i swapAll  = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+        const __m128i swap7    = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 14, 15);
+        return _mm_shuffle_epi8(v, (swapped == 8) ? swapAll : swap7);
+#else
+        __m128i s = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        if (swapped == 8)
+        {
+            return s;
+        }
+        const __m128i keep = _mm_setr_epi16(0, 0, 0, 0, 0, 0, 0, -1);
+        return _mm_or_si128(_mm_andnot_si128(keep, s), _mm_and_si128(keep, v));
+#endif
+    }
+
+    /* 8x8 int16 transpose: r[frame] lanes = channels -> r[channel] lanes = frames */
+    inline void transpose8x8(__m128i r[8])
+    {
+        const __m128i t0 = _mm_unpacklo_epi16(r[0], r[1]);
+        const __m128i t1 = _mm_unpackhi_epi16(r[0], r[1]);
+        const __m128i t2 = _mm_unpacklo_epi16(r[2], r[3]);
+        const __m128i t3 = _mm_unpackhi_epi16(r[2], r[3]);
+        const __m128i t4 = _mm_unpacklo_epi16(r[4], r[5]);
+        const __m128i t5 = _mm_unpackhi_epi16(r[4], r[5]);
+        const __m128i t6 = _mm_unpacklo_epi16(r[6], r[7]);
+        const __m128i t7 = _mm_unpackhi_epi16(r[6], r[7]);
+
+        const __m128i u0 = _mm_unpacklo_epi32(t0, t2);
+        const __m128i u1 = _mm_unpackhi_epi32(t0, t2);
+        const __m128i u2 = _mm_unpacklo_epi32(t1, t3);
+        const __m128i u3 = _mm_unpackhi_epi32(t1, t3);
+        const __m128i u4 = _mm_unpacklo_epi32(t4, t6);
+        const __m128i u5 = _mm_unpackhi_epi32(t4, t6);
+        const __m128i u6 = _mm_unpacklo_epi32(t5, t7);
+        const __m128i u7 = _mm_unpackhi_epi32(t5, t7);
+
+        r[0] = _mm_unpacklo_epi64(u0, u4);
+        r[1] = _mm_unpackhi_epi64(u0, u4);
+        r[2] = _mm_unpacklo_epi64(u1, u5);
+        r[3] = _mm_unpackhi_epi64(u1, u5);
+        r[4] = _mm_unpacklo_epi64(u2, u6);
+        r[5] = _mm_unpackhi_epi64(u2, u6);
+        r[6] = _mm_unpacklo_epi64(u3, u7);
+        r[7] = _mm_unpackhi_epi64(u3, u7);
+    }
+#endif
+
+#if defined(__AVX2__)
+    inline __m256i load2x128(const uint8_t* lo, const uint8_t* hi)
+    {
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)lo)),
+                                       _mm_loadu_si128((const __m128i*)hi), 1);
+    }
+
+    /* Same transpose as transpose8x8, independently in both 128-bit lanes */
+    inline void transpose8x8x2(__m256i r[8])
+    {
+        const __m256i t0 = _mm256_unpacklo_epi16(r[0], r[1]);
+        const __m256i t1 = _mm256_unpackhi_epi16(r[0], r[1]);
+        const __m256i t2 = _mm256_unpacklo_epi16(r[2], r[3]);
+        const __m256i t3 = _mm256_unpackhi_epi16(r[2], r[3]);
+        const __m256i t4 = _mm256_unpacklo_epi16(r[4], r[5]);
+        const __m256i t5 = _mm256_unpackhi_epi16(r[4], r[5]);
+        const __m256i t6 = _mm256_unpacklo_epi16(r[6], r[7]);
+        const __m256i t7 = _mm256_unpackhi_epi16(r[6], r[7]);
+
+        const __m256i u0 = _mm256_unpacklo_epi32(t0, t2);
+        const __m256i u1 = _mm256_unpackhi_epi32(t0, t2);
+        const __m256i u2 = _mm256_unpacklo_epi32(t1, t3);
+        const __m256i u3 = _mm256_unpackhi_epi32(t1, t3);
+        const __m256i u4 = _mm256_unpacklo_epi32(t4, t6);
+        const __m256i u5 = _mm256_unpackhi_epi32(t4, t6);
+        const __m256i u6 = _mm256_unpacklo_epi32(t5, t7);
+        const __m256i u7 = _mm256_unpackhi_epi32(t5, t7);
+
+        r[0] = _mm256_unpacklo_epi64(u0, u4);
+        r[1] = _mm256_unpackhi_epi64(u0, u4);
+        r[2] = _mm256_unpacklo_epi64(u1, u5);
+        r[3] = _mm256_unpackhi_epi64(u1, u5);
+        r[4] = _mm256_unpacklo_epi64(u2, u6);
+        r[5] = _mm256_unpackhi_epi64(u2, u6);
+        r[6] = _mm256_unpacklo_epi64(u3, u7);
+        r[7] = _mm256_unpackhi_epi64(u3, u7);
+    }
+#endif
+}
+
+/* ************************************** Scalar reference **************************************** */
+
+void decodeFramesScalar(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+    decodeTail(bytes, 0, frames, out);
+}
+
+void decodeFrames9Scalar(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+    decodeTail9(bytes, 0, frames, out);
+}
+
+/* ************************************** SSE2 / SSSE3 **************************************** */
+
+#if defined(__SSE2__)
+void decodeFramesSSE2(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+    size_t f = 0;
+    for (; f + 8 <= frames; f += 8)
+    {
+        const uint8_t* p = bytes + f * MPU9250_FRAME_BYTES;
+        __m128i r[8];
+        for (int i = 0; i < 7; i++)
+        {
+            r[i] = _mm_loadu_si128((const __m128i*)(p + i * MPU9250_FRAME_BYTES));
+        }
+        /* Last frame ends at byte 112: load from 96 and shift down so we never read past it */
+        r[7] = _mm_srli_si128(_mm_loadu_si128((const __m128i*)(p + 7 * MPU9250_FRAME_BYTES - 2)), 2);
+
+        for (int i = 0; i < 8; i++)
+        {
+            r[i] = swap16(r[i], 8);
+        }
+        transpose8x8(r);
+
+        for (uint8_t c = FRAME_ACCEL_X; c <= FRAME_GYRO_Z; c++)
+        {
+            _mm_storeu_si128((__m128i*)(out.channel[c] + f), r[c]);
+        }
+    }
+    decodeTail(bytes, f, frames, out);
+}
+
+void decodeFrames9SSE2(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+    size_t f = 0;
+    for (; f + 8 <= frames; f += 8)
+    {
+        const uint8_t* p = bytes + f * MPU9250_FRAME9_BYTES;
+        __m128i r[8];
+        for (int i = 0; i < 8; i++)
+        {
+            /* Bytes 0..15 of each frame: seven big-endian words then MAG_X */
+            r[i] = swap16(_mm_loadu_si128((const __m128i*)(p + i * MPU9250_FRAME9_BYTES)), 7);
+        }
+        transpose8x8(r);
+
+        for (uint8_t c = FRAME_ACCEL_X; c <= FRAME_MAG_X; c++)
+        {
+            _mm_storeu_si128((__m128i*)(out.channel[c] + f), r[c]);
+        }
+        for (int i = 0; i < 8; i++)
+        {
+            const uint8_t* q = p + i * MPU9250_FRAME9_BYTES;
+            out.channel[FRAME_MAG_Y][f + i] = le16(q + 16);
+            out.channel[FRAME_MAG_Z][f + i] = le16(q + 18);
+        }
+    }
+    decodeTail9(bytes, f, frames, out);
+}
+#endif
+
+/* ************************************** AVX2 **************************************** */
+
+#if defined(__AVX2__)
+void decodeFramesAVX2(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+    const __m256i swapAll = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    size_t f = 0;
+    for (; f + 16 <= frames; f += 16)
+    {
+        const uint8_t* p = bytes + f * MPU9250_FRAME_BYTES;
+        const uint8_t* q = p + 8 * MPU9250_FRAME_BYTES;
+        __m256i r[8];
+        for (int i = 0; i < 7; i++)
+        {
+            r[i] = load2x128(p + i * MPU9250_FRAME_BYTES, q + i * MPU9250_FRAME_BYTES);
+        }
+        r[7] = _mm256_srli_si256(load2x128(p + 7 * MPU9250_FRAME_BYTES - 2,
+                                           q + 7 * MPU9250_FRAME_BYTES - 2), 2);
+
+        for (int i = 0; i < 8; i++)
+        {
+            r[i] = _mm256_shuffle_epi8(r[i], swapAll);
+        }
+        transpose8x8x2(r);
+
+        /* Low lane holds frames f..f+7, high lane f+8..f+15: one contiguous store */
+        for (uint8_t c = FRAME_ACCEL_X; c <= FRAME_GYRO_Z; c++)
+        {
+            _mm256_storeu_si256((__m256i*)(out.channel[c] + f), r[c]);
+        }
+    }
+    decodeFramesSSE2(bytes + f * MPU9250_FRAME_BYTES, frames - f,
+                     FrameColumns{{out.channel[0] + f, out.channel[1] + f, out.channel[2] + f,
+                                   out.channel[3] + f, out.channel[4] + f, out.channel[5] + f,
+                                   out.channel[6] + f, nullptr, nullptr, nullptr}});
+}
+
+void decodeFrames9AVX2(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+    const __m256i swap7 = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 14, 15,
+                                           1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 14, 15);
+    size_t f = 0;
+    for (; f + 16 <= frames; f += 16)
+    {
+        const uint8_t* p = bytes + f * MPU9250_FRAME9_BYTES;
+        const uint8_t* q = p + 8 * MPU9250_FRAME9_BYTES;
+        __m256i r[8];
+        for (int i = 0; i < 8; i++)
+        {
+            r[i] = _mm256_shuffle_epi8(load2x128(p + i * MPU9250_FRAME9_BYTES,
+                                                 q + i * MPU9250_FRAME9_BYTES), swap7);
+        }
+        transpose8x8x2(r);
+
+        for (uint8_t c = FRAME_ACCEL_X; c <= FRAME_MAG_X; c++)
+        {
+            _mm256_storeu_si256((__m256i*)(out.channel[c] + f), r[c]);
+        }
+        for (int i = 0; i < 16; i++)
+        {
+            const uint8_t* s = p + i * MPU9250_FRAME9_BYTES;
+            out.channel[FRAME_MAG_Y][f + i] = le16(s + 16);
+            out.channel[FRAME_MAG_Z][f + i] = le16(s + 18);
+        }
+    }
+    decodeTail9(bytes, f, frames, out);
+}
+#endif
+
+/* ************************************** Cortex-M0+ **************************************** */
+
+#if defined(__ARM_ARCH_6M__)
+namespace
+{
+    /* ldrh + rev16 + sxth; the caller guarantees 2-byte alignment */
+    inline int16_t be16Aligned(const uint8_t* p)
+    {
+        uint16_t w;
+        std::memcpy(&w, __builtin_assume_aligned(p, 2), sizeof(w));
+        return (int16_t)__builtin_bswap16(w);
+    }
+
+    inline int16_t le16Aligned(const uint8_t* p)
+    {
+        uint16_t w;
+        std::memcpy(&w, __builtin_assume_aligned(p, 2), sizeof(w));
+        return (int16_t)w;
+    }
+}
+
+void decodeFramesM0(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+    if (((uintptr_t)bytes & 1u) != 0)
+    {
+        decodeTail(bytes, 0, frames, out);
+        return;
+    }
+
+    int16_t* ax = out.channel[FRAME_ACCEL_X];
+    int16_t* ay = out.channel[FRAME_ACCEL_Y];
+    int16_t* az = out.channel[FRAME_ACCEL_Z];
+    int16_t* t  = out.channel[FRAME_TEMP];
+    int16_t* gx = out.channel[FRAME_GYRO_X];
+    int16_t* gy = out.channel[FRAME_GYRO_Y];
+    int16_t* gz = out.channel[FRAME_GYRO_Z];
+
+    const uint8_t* p = bytes;
+    for (size_t f = 0; f < frames; f++, p += MPU9250_FRAME_BYTES)
+    {
+        ax[f] = be16Aligned(p + 0);
+        ay[f] = be16Aligned(p + 2);
+        az[f] = be16Aligned(p + 4);
+        t[f]  = be16Aligned(p + 6);
+        gx[f] = be16Aligned(p + 8);
+        gy[f] = be16Aligned(p + 10);
+        gz[f] = be16Aligned(p + 12);
+    }
+}
+
+void decodeFrames9M0(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+    if (((uintptr_t)bytes & 1u) != 0)
+    {
+        decodeTail9(bytes, 0, frames, out);
+        return;
+    }
+
+    int16_t* ax = out.channel[FRAME_ACCEL_X];
+    int16_t* ay = out.channel[FRAME_ACCEL_Y];
+    int16_t* az = out.channel[FRAME_ACCEL_Z];
+    int16_t* t  = out.channel[FRAME_TEMP];
+    int16_t* gx = out.channel[FRAME_GYRO_X];
+    int16_t* gy = out.channel[FRAME_GYRO_Y];
+    int16_t* gz = out.channel[FRAME_GYRO_Z];
+    int16_t* mx = out.channel[FRAME_MAG_X];
+    int16_t* my = out.channel[FRAME_MAG_Y];
+    int16_t* mz = out.channel[FRAME_MAG_Z];
+
+    const uint8_t* p = bytes;
+    for (size_t f = 0; f < frames; f++, p += MPU9250_FRAME9_BYTES)
+    {
+        ax[f] = be16Aligned(p + 0);
+        ay[f] = be16Aligned(p + 2);
+        az[f] = be16Aligned(p + 4);
+        t[f]  = be16Aligned(p + 6);
+        gx[f] = be16Aligned(p + 8);
+        gy[f] = be16Aligned(p + 10);
+        gz[f] = be16Aligned(p + 12);
+        mx[f] = le16Aligned(p + 14);
+        my[f] = le16Aligned(p + 16);
+        mz[f] = le16Aligned(p + 18);
+    }
+}
+#endif
+
+/* ************************************** Dispatch **************************************** */
+
+void decodeFrames(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+#if defined(__AVX2__)
+    decodeFramesAVX2(bytes, frames, out);
+#elif defined(__SSE2__)
+    decodeFramesSSE2(bytes, frames, out);
+#elif defined(__ARM_ARCH_6M__)
+    decodeFramesM0(bytes, frames, out);
+#else
+    decodeFramesScalar(bytes, frames, out);
+#endif
+}
+
+void decodeFrames9(const uint8_t* bytes, size_t frames, const FrameColumns& out)
+{
+#if defined(__AVX2__)
+    decodeFrames9AVX2(bytes, frames, out);
+#elif defined(__SSE2__)
+    decodeFrames9SSE2(bytes, frames, out);
+#elif defined(__ARM_ARCH_6M__)
+    decodeFrames9M0(bytes, frames, out);
+#else
+    decodeFrames9Scalar(bytes, frames, out);
+#endif
+}
+
+const char* decodeKernelName()
+{
+#if defined(__AVX2__)
+    return "AVX2";
+#elif defined(__SSSE3__)
+    return "SSSE3";
+#elif defined(__SSE2__)
+    return "SSE2";
+#elif defined(__ARM_ARCH_6M__)
+    return "M0+";
+#else
+    return "scalar";
+#endif
+}
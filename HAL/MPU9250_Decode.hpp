@@ -0,0 +1,115 @@
+/**
+ * @file : MPU9250_Decode.hpp
+ * @brief: Batch decoders for raw MPU9250 sensor frames.
+ *
+ * The MPU9250 returns its measurements as big-endian int16 words starting at
+ * ACCEL_XOUT_H: accel X/Y/Z, temperature, gyro X/Y/Z (14 bytes). When the
+ * AK8963 is read through the slave interface, its little-endian X/Y/Z words
+ * follow in EXT_SENS_DATA, giving a 20-byte 9-axis frame.
+ *
+ * The functions below turn a buffer of N such frames (a FIFO burst or a
+ * replayed capture) into structure-of-arrays int16 channels. decodeFrames()
+ * and decodeFrames9() use the fastest kernel available for the target:
+ * AVX2 or SSSE3/SSE2 byte shuffles plus an 8x8 transpose on the host, and
+ * halfword loads with REV16 on the Cortex-M0+. The scalar kernels are the
+ * reference every other kernel must match bit for bit.
+ *
+ * @author :[Sara Saad , Hager Shohieb]
+ * @version:1.0
+ * @date   :December 01, 2025
+ *
+ **/
+
+#ifndef MPU9250_DECODE_HPP
+#define MPU9250_DECODE_HPP
+
+/* ************************************** Include Part **************************************** */
+/* cstdint: Standard integer types.*/
+#include <cstdint>
+/* cstddef: size_t.*/
+#include <cstddef>
+/* ******************************************************************************************** */
+
+/* Bytes in one accel/temp/gyro frame */
+constexpr size_t MPU9250_FRAME_BYTES  = 14;
+/* Bytes in one accel/temp/gyro/mag frame */
+constexpr size_t MPU9250_FRAME9_BYTES = 20;
+
+/**
+ * @enum  :FrameChannel
+ * @brief :Channel index inside a FrameColumns set, in frame order.
+ */
+enum FrameChannel : uint8_t
+{
+    FRAME_ACCEL_X = 0,
+    FRAME_ACCEL_Y,
+    FRAME_ACCEL_Z,
+    FRAME_TEMP,
+    FRAME_GYRO_X,
+    FRAME_GYRO_Y,
+    FRAME_GYRO_Z,
+    FRAME_MAG_X,
+    FRAME_MAG_Y,
+    FRAME_MAG_Z,
+    FRAME_CHANNEL_COUNT
+};
+
+/**
+ * @struct :FrameColumns
+ * @brief  :Destination columns, one int16 array per channel.
+ *
+ * Each array must hold at least as many entries as frames decoded. The MAG
+ * columns are only written by the 9-axis decoders and may be NULL otherwise.
+ */
+struct FrameColumns
+{
+    int16_t* channel[FRAME_CHANNEL_COUNT];
+};
+
+/**
+ * @brief :Decode 14-byte frames with the fastest available kernel.
+ *
+ * @param bytes  :Start of frames[0]; frames are packed back to back.
+ * @param frames :Number of frames.
+ * @param out    :Destination columns (accel, temp, gyro).
+ */
+void decodeFrames(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+
+/**
+ * @brief :Decode 20-byte 9-axis frames with the fastest available kernel.
+ *
+ * @param bytes  :Start of frames[0]; frames are packed back to back.
+ * @param frames :Number of frames.
+ * @param out    :Destination columns (all channels).
+ */
+void decodeFrames9(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+
+/**
+ * @brief :Name of the kernel decodeFrames()/decodeFrames9() dispatch to.
+ */
+const char* decodeKernelName();
+
+/* ******************************** Individual kernels ************************************ */
+/* Reference implementations, always available. */
+void decodeFramesScalar(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+void decodeFrames9Scalar(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+
+#if defined(__SSE2__)
+/* Host kernels: 8 frames per iteration, SSE2 shifts or SSSE3 pshufb for the byte swap. */
+void decodeFramesSSE2(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+void decodeFrames9SSE2(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+#endif
+
+#if defined(__AVX2__)
+/* Host kernels: 16 frames per iteration, two frames per 256-bit register. */
+void decodeFramesAVX2(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+void decodeFrames9AVX2(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+#endif
+
+#if defined(__ARM_ARCH_6M__)
+/* Cortex-M0+ kernels: halfword loads and REV16 when the buffer is 2-byte aligned. */
+void decodeFramesM0(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+void decodeFrames9M0(const uint8_t* bytes, size_t frames, const FrameColumns& out);
+#endif
+
+#endif // MPU9250_DECODE_HPP
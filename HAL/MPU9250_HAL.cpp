@@ -1,8 +1,92 @@
 #include "MPU9250_HAL.hpp"
 #include <cstring>
 
+using namespace MPU9250Reg;
+
+namespace
+{
+    /* Default configuration, folded to constant bytes at compile time */
+    constexpr auto RESET_VALUE  = PWR_MGMT_1::H_RESET(true).whole();
+    constexpr auto WAKE_VALUE   = PWR_MGMT_1::CLKSEL(ClockSource::AUTO_PLL).whole();
+    constexpr auto CONFIG_VALUE = CONFIG::FIFO_MODE(false) | CONFIG::EXT_SYNC_SET(0) |
+                                  CONFIG::DLPF_CFG(GyroDlpf::BW_41HZ);
+    constexpr auto SMPLRT_VALUE = SMPLRT_DIV::DIVIDER(4);
+    constexpr auto ACCEL2_VALUE = ACCEL_CONFIG2::ACCEL_FCHOICE_B(false) |
+                                  ACCEL_CONFIG2::A_DLPF_CFG(AccelDlpf::BW_45HZ);
+    constexpr auto BYPASS_VALUE = INT_PIN_CFG::BYPASS_EN(true);
+    constexpr auto GYRO_CFG_VALUE  = GYRO_CONFIG::GYRO_FS_SEL(GyroFullScale::DPS_250);
+    constexpr auto ACCEL_CFG_VALUE = ACCEL_CONFIG::ACCEL_FS_SEL(AccelFullScale::G_2);
+
+    static_assert(RESET_VALUE.bits  == 0x80, "reset byte");
+    static_assert(WAKE_VALUE.bits   == 0x01, "wake byte");
+    static_assert(CONFIG_VALUE.bits == 0x03, "CONFIG byte");
+    static_assert(SMPLRT_VALUE.bits == 0x04, "SMPLRT_DIV byte");
+    static_assert(ACCEL2_VALUE.bits == 0x03, "ACCEL_CONFIG2 byte");
+    static_assert(BYPASS_VALUE.bits == 0x02, "INT_PIN_CFG byte");
+
+    /* Wake-on-motion: accel-only cycling, gyro off, WOM logic comparing against the previous sample */
+    constexpr auto WOM_GYRO_OFF    = (PWR_MGMT_2::DISABLE_ACCEL_XYZ(0) | PWR_MGMT_2::DISABLE_GYRO_XYZ(7)).whole();
+    constexpr auto WOM_ACCEL2      = ACCEL_CONFIG2::ACCEL_FCHOICE_B(false) |
+                                     ACCEL_CONFIG2::A_DLPF_CFG(AccelDlpf::BW_218HZ);
+    constexpr auto WOM_INT_PIN     = INT_PIN_CFG::LATCH_INT_EN(true);
+    constexpr auto WOM_INT_ENABLE  = INT_ENABLE::WOM_EN(true).whole();
+    constexpr auto WOM_DETECT      = (MOT_DETECT_CTRL::ACCEL_INTEL_EN(true) | MOT_DETECT_CTRL::ACCEL_INTEL_MODE(true)).whole();
+    constexpr auto WOM_CYCLE       = (PWR_MGMT_1::CYCLE(true) | PWR_MGMT_1::CLKSEL(ClockSource::AUTO_PLL)).whole();
+    constexpr auto ALL_SENSORS_ON  = (PWR_MGMT_2::DISABLE_ACCEL_XYZ(0) | PWR_MGMT_2::DISABLE_GYRO_XYZ(0)).whole();
+    constexpr auto INT_DISABLED    = INT_ENABLE::WOM_EN(false).whole();
+    constexpr auto DETECT_DISABLED = MOT_DETECT_CTRL::ACCEL_INTEL_EN(false).whole();
+
+    /* WOM_THR resolution */
+    constexpr uint16_t WOM_MG_PER_LSB = 4;
+
+    static_assert(WOM_GYRO_OFF.bits   == 0x07, "PWR_MGMT_2 gyro standby byte");
+    static_assert(WOM_INT_PIN.bits    == 0x20, "INT_PIN_CFG latch byte");
+    static_assert(WOM_INT_ENABLE.bits == 0x40, "INT_ENABLE WOM byte");
+    static_assert(WOM_DETECT.bits     == 0xC0, "MOT_DETECT_CTRL byte");
+    static_assert(WOM_CYCLE.bits      == 0x21, "PWR_MGMT_1 cycle byte");
+
+    /* Every read path lists the registers it needs; planReads() turns that into the fewest bursts */
+    constexpr auto ACCEL_PLAN = planReads(wordRegs<3>({ACCEL_XOUT_H::address, ACCEL_YOUT_H::address,
+                                                       ACCEL_ZOUT_H::address}));
+    constexpr auto GYRO_PLAN  = planReads(wordRegs<3>({GYRO_XOUT_H::address, GYRO_YOUT_H::address,
+                                                       GYRO_ZOUT_H::address}));
+    constexpr auto TEMP_PLAN  = planReads(wordRegs<1>({TEMP_OUT_H::address}));
+    constexpr auto ALL_PLAN   = planReads(wordRegs<7>({ACCEL_XOUT_H::address, ACCEL_YOUT_H::address,
+                                                       ACCEL_ZOUT_H::address, TEMP_OUT_H::address,
+                                                       GYRO_XOUT_H::address, GYRO_YOUT_H::address,
+                                                       GYRO_ZOUT_H::address}));
+
+    static_assert(ACCEL_PLAN.count == 1 && GYRO_PLAN.count == 1 && TEMP_PLAN.count == 1, "one burst per sensor");
+    static_assert(ALL_PLAN.count == 1 && planBytes(ALL_PLAN) == 14, "accel + temp + gyro merge into one 14-byte burst");
+
+    /* SMPLRT_DIV, CONFIG, GYRO_CONFIG, ACCEL_CONFIG, ACCEL_CONFIG2: written and verified as one block */
+    constexpr ReadSpan CONFIG_SPAN = spanOf<SMPLRT_DIV, ACCEL_CONFIG2>();
+    static_assert(CONFIG_SPAN.length == MPU9250_CONFIG_BYTES, "config shadow covers the config block");
+
+    /* configMatches(): PWR_MGMT_1 and the config block sit in different blocks, so two bursts */
+    constexpr auto VERIFY_PLAN = planReads<6>({PWR_MGMT_1::address, SMPLRT_DIV::address, CONFIG::address,
+                                               GYRO_CONFIG::address, ACCEL_CONFIG::address, ACCEL_CONFIG2::address});
+    static_assert(VERIFY_PLAN.count == 2, "PWR_MGMT_1 is outside the config burst block");
+
+    /* Big-endian 16-bit output register `high` from a buffer filled by `plan` */
+    template <size_t N>
+    int16_t wordAt(const ReadPlan<N> &plan, const uint8_t *buf, uint8_t high)
+    {
+        const size_t i = planOffset(plan, high);
+        return (int16_t)((buf[i] << 8) | buf[i + 1]);
+    }
+
+    /* Reset normally completes within a few ms; a stuck bus is reported as FAILED */
+    constexpr uint32_t INIT_TIMEOUT_US = 200000;
+    constexpr uint32_t INIT_POLL_US    = 500;
+}
+
 MPU9250_HAL::MPU9250_HAL(i2c_inst_t* i2c, uint8_t address)
-: i2c_(i2c), address_(address), i2c_configured_(false){ }
+: i2c_(i2c), address_(address), i2c_configured_(false),
+  initState_(InitState::IDLE), initStart_us_(0), initWake_us_(0), initDone_us_(0),
+  shadow_{SMPLRT_VALUE.bits, CONFIG_VALUE.bits, GYRO_CFG_VALUE.bits, ACCEL_CFG_VALUE.bits, ACCEL2_VALUE.bits},
+  intPinCfg_(0)
+{ }
 
 bool MPU9250_HAL::begin(uint sda_pin, uint scl_pin, uint32_t baudrate_hz) 
 {
@@ -14,7 +98,7 @@ bool MPU9250_HAL::begin(uint sda_pin, uint scl_pin, uint32_t baudrate_hz)
     gpio_pull_up(scl_pin);
     i2c_configured_ = true;
 
-    sleep_ms(10);
+    /* No settle delay: a device still powering up simply NACKs and the caller retries */
     return testConnection();
 }
 
@@ -25,9 +109,12 @@ bool MPU9250_HAL::testConnection() // edit private function
         return false;
     }
     uint8_t who;
-    readBytes(WHO_AM_I,&who,1);
-    /* WHO_AM_I for MPU6500 typically 0x70 or 0x71 or 0x73 etc depending on part; accept non-zero */
-    if((who == 70) || (who == 71) || (who == 73)) // edit to the first 
+    if(!readBytes(WHO_AM_I::address,&who,1))
+    {
+        return false;
+    }
+    /* WHO_AM_I reads 0x71 on the MPU9250, 0x73 on the MPU9255 and 0x70 on a bare MPU6500 */
+    if((who == WHO_AM_I_MPU9250) || (who == WHO_AM_I_MPU9255) || (who == WHO_AM_I_MPU6500))
     {
         return (true);
     }
@@ -40,69 +127,236 @@ bool MPU9250_HAL::testConnection() // edit private function
 
 bool MPU9250_HAL::initMPU9250() 
 {
-    if(!i2c_configured_)
+    if(!startInit(false))
     {
         return false;
     }
 
-    /* Reset device : write 1 on bit 7 */
-    if(!writeByte(PWR_MGMT_1, 0x80)) 
+    /* Poll the state machine instead of sleeping for the worst case */
+    while(true)
+    {
+        InitState state = pollInit();
+        if(state == InitState::READY)
+        {
+            return true;
+        }
+        if(state == InitState::FAILED)
+        {
+            return false;
+        }
+        sleep_us(INIT_POLL_US);
+    }
+}
+
+bool MPU9250_HAL::startInit(bool force)
+{
+    if(!i2c_configured_)
     {
         return false;
     }
-    sleep_ms(100);
 
-    /* Wake up and set clock source to PLL with X axis gyroscope reference: write 1 on bit 0 */
-    if(!writeByte(PWR_MGMT_1, 0x01))
+    /* A failed init is retried from reset, never adopted */
+    if(!force && (initState_ != InitState::FAILED))
+    {
+        if((initState_ == InitState::RESETTING) || (initState_ == InitState::WAKING) ||
+           (initState_ == InitState::WAIT_DATA))
+        {
+            return true; // already in progress
+        }
+
+        /* Device already awake with the shadowed configuration: nothing to do */
+        if(configMatches())
+        {
+            initStart_us_ = time_us_32();
+            initDone_us_  = initStart_us_;
+            initState_    = InitState::READY;
+            return true;
+        }
+    }
+
+    /* Reset device : write 1 on bit 7, cleared by the device when done */
+    if(!writeReg(RESET_VALUE)) 
     {
+        initState_ = InitState::FAILED;
         return false;
     }
-    sleep_ms(50);
+    initStart_us_ = time_us_32();
+    initState_    = InitState::RESETTING;
+    intPinCfg_    = 0;  // reset value
+    return true;
+}
 
+InitState MPU9250_HAL::pollInit()
+{
+    uint8_t pwr;
 
-    /* CONFIG: disable FSYNC, set DLPF (0) , enable LPS */
-    if(!writeByte(CONFIG, 0x03)) 
+    switch(initState_)
     {
-        return false; // set some DLPF
+        case InitState::RESETTING:
+            /* The device may NACK while resetting; keep polling until H_RESET clears */
+            if(readBytes(PWR_MGMT_1::address, &pwr, 1) && ((pwr & PWR_MGMT_1::H_RESET.mask) == 0))
+            {
+                /* Wake up and set clock source to PLL with X axis gyroscope reference */
+                if(writeReg(WAKE_VALUE))
+                {
+                    initWake_us_ = time_us_32();
+                    initState_   = InitState::WAKING;
+                }
+            }
+            break;
+
+        case InitState::WAKING:
+            /* Once SLEEP reads back clear, load the whole configuration in one burst */
+            if(readBytes(PWR_MGMT_1::address, &pwr, 1) && (pwr == WAKE_VALUE.bits))
+            {
+                if(writeBytes(CONFIG_SPAN.first, shadow_, sizeof(shadow_)) && configMatches())
+                {
+                    initState_ = InitState::WAIT_DATA;
+                }
+            }
+            break;
+
+        case InitState::WAIT_DATA:
+        {
+            /* Output registers read zero until the first conversion lands; the gyro
+               converts while it spins up, so its output only counts after the settle time */
+            int16_t ax, ay, az, gx, gy, gz, temp;
+            if(((time_us_32() - initWake_us_) >= MPU9250_GYRO_SETTLE_US) &&
+               readAllRaw(ax, ay, az, gx, gy, gz, temp) &&
+               ((ax != 0) || (ay != 0) || (az != 0)) &&
+               ((gx != 0) || (gy != 0) || (gz != 0)))
+            {
+                initDone_us_ = time_us_32();
+                initState_   = InitState::READY;
+            }
+            break;
+        }
+
+        default:
+            return initState_;
     }
-    
-    /* Set sample rate divider (SMPLRT_DIV) */
-    if(!writeByte(SMPLRT_DIV, 0x04))
+
+    if((initState_ != InitState::READY) && ((time_us_32() - initStart_us_) > INIT_TIMEOUT_US))
     {
-        return false; // sample = gyro_rate/(1+4)
-    } 
+        initState_ = InitState::FAILED;
+    }
+
+    return initState_;
+}
 
-    /* ACCEL_CONFIG2: set DLPF for accel */
-    if(!writeByte(ACCEL_CONFIG2, 0x03))
+uint32_t MPU9250_HAL::initDuration_us() const
+{
+    if(initState_ != InitState::READY)
     {
-        return false;
+        return 0;
+    }
+    return initDone_us_ - initStart_us_;
+}
+
+bool MPU9250_HAL::setSampleRate(uint8_t divider, GyroDlpf gyroDlpf, AccelDlpf accelDlpf, size_t* bytesWritten)
+{
+    if(bytesWritten != nullptr)
+    {
+        *bytesWritten = 0;
     }
 
-    /*
+    uint8_t next[MPU9250_CONFIG_BYTES];
+    std::memcpy(next, shadow_, sizeof(next));
 
-    // INT pin config: enable bypass to access magnetometer directly if needed
-    if(!writeByte(INT_PIN_CFG, 0x02))
+    /* Offsets inside the SMPLRT_DIV .. ACCEL_CONFIG2 block */
+    next[SMPLRT_DIV::address    - CONFIG_SPAN.first] = SMPLRT_DIV::DIVIDER(divider).bits;
+    next[CONFIG::address        - CONFIG_SPAN.first] =
+        CONFIG::DLPF_CFG(gyroDlpf).applyTo(shadow_[CONFIG::address - CONFIG_SPAN.first]);
+    next[ACCEL_CONFIG2::address - CONFIG_SPAN.first] =
+        ACCEL_CONFIG2::A_DLPF_CFG(accelDlpf).applyTo(shadow_[ACCEL_CONFIG2::address - CONFIG_SPAN.first]);
+
+    if(std::memcmp(next, shadow_, sizeof(next)) == 0)
+    {
+        return true;
+    }
+
+    if(!writeBytes(CONFIG_SPAN.first, next, sizeof(next)))
     {
         return false;
     }
+    std::memcpy(shadow_, next, sizeof(shadow_));
+    if(bytesWritten != nullptr)
+    {
+        *bytesWritten = sizeof(next);
+    }
+    return true;
+}
+
+bool MPU9250_HAL::enterWakeOnMotion(uint16_t threshold_mg, LpAccelOdr wakeRate)
+{
+    uint16_t lsb = (uint16_t)((threshold_mg + (WOM_MG_PER_LSB / 2)) / WOM_MG_PER_LSB);
+    if(lsb > 0xFF)
+    {
+        lsb = 0xFF;
+    }
 
-    // Enable data ready interrupt 
-    if(!writeByte(INT_ENABLE, 0x01))
+    /* Order follows the datasheet wake-on-motion sequence; CYCLE goes last. ACCEL_CONFIG2 and
+       INT_PIN_CFG are temporary overrides: their shadows keep the values exitWakeOnMotion() restores */
+    if(!writeReg(WAKE_VALUE) ||
+       !writeReg(WOM_GYRO_OFF) ||
+       !writeByte(ACCEL_CONFIG2::address, WOM_ACCEL2.applyTo(*shadowOf(ACCEL_CONFIG2::address))) ||
+       !writeByte(INT_PIN_CFG::address, WOM_INT_PIN.applyTo(intPinCfg_)) ||
+       !writeReg(WOM_INT_ENABLE) ||
+       !writeReg(WOM_DETECT) ||
+       !writeReg(WOM_THR::WOM_THRESHOLD((uint8_t)lsb)) ||
+       !writeReg(LP_ACCEL_ODR::LPOSC_CLKSEL(wakeRate).whole()) ||
+       !writeReg(WOM_CYCLE))
     {
         return false;
     }
-    
-    sleep_ms(50);
 
-    // Disable I2C master (we use bypass), disable sleep mode important for magnometer 
-    if(!writeByte(USER_CTRL, 0x00))
+    uint8_t status;
+    return readIntStatus(status);
+}
+
+bool MPU9250_HAL::exitWakeOnMotion()
+{
+    /* Leave cycle mode first so the remaining writes land at full speed */
+    if(!writeReg(WAKE_VALUE) ||
+       !writeReg(ALL_SENSORS_ON) ||
+       !writeReg(INT_DISABLED) ||
+       !writeReg(DETECT_DISABLED) ||
+       !writeByte(INT_PIN_CFG::address, intPinCfg_))
     {
         return false;
     }
-    sleep_ms(10);
-    */
 
-    return true;
+    /* Restores ACCEL_CONFIG2 and anything else the WOM sequence touched */
+    return writeBytes(CONFIG_SPAN.first, shadow_, sizeof(shadow_));
+}
+
+uint8_t *MPU9250_HAL::shadowOf(uint8_t reg)
+{
+    if((reg >= CONFIG_SPAN.first) && (reg < (CONFIG_SPAN.first + CONFIG_SPAN.length)))
+    {
+        return &shadow_[reg - CONFIG_SPAN.first];
+    }
+    if(reg == INT_PIN_CFG::address)
+    {
+        return &intPinCfg_;
+    }
+    return nullptr;
+}
+
+bool MPU9250_HAL::readIntStatus(uint8_t &status)
+{
+    return readBytes(INT_STATUS::address, &status, 1);
+}
+
+bool MPU9250_HAL::configMatches()
+{
+    uint8_t buf[planBytes(VERIFY_PLAN)];
+
+    if(!readPlan(VERIFY_PLAN, buf) || (buf[planOffset(VERIFY_PLAN, PWR_MGMT_1::address)] != WAKE_VALUE.bits))
+    {
+        return false;
+    }
+    return (std::memcmp(&buf[planOffset(VERIFY_PLAN, CONFIG_SPAN.first)], shadow_, sizeof(shadow_)) == 0);
 }
 
 bool MPU9250_HAL::readBytes(uint8_t reg, uint8_t* buffer, size_t len)
@@ -136,45 +390,61 @@ bool MPU9250_HAL::writeByte(uint8_t reg, uint8_t value)
     return (ret == 2);
 }
 
+bool MPU9250_HAL::writeBytes(uint8_t reg, const uint8_t* data, size_t len)
+{
+    if(!i2c_configured_ || (len > MPU9250_CONFIG_BYTES))
+    {
+        return false;
+    }
+
+    /* Register auto-increment applies to writes as well: one transaction */
+    uint8_t buf[MPU9250_CONFIG_BYTES + 1];
+    buf[0] = reg;
+    std::memcpy(&buf[1], data, len);
+    int ret = i2c_write_blocking(i2c_, address_, buf, len + 1, false); // send with stop
+
+    return (ret == (int)(len + 1));
+}
+
 bool MPU9250_HAL::readAccelRaw(int16_t &ax, int16_t &ay, int16_t &az) 
 {
-    uint8_t buf[6];
-    if(!readBytes(ACCEL_XOUT_H, buf, 6)) 
+    uint8_t buf[planBytes(ACCEL_PLAN)];
+    if(!readPlan(ACCEL_PLAN, buf)) 
     {
         return false;
     }
 
-    ax = (int16_t)((buf[0] << 8) | buf[1]);
-    ay = (int16_t)((buf[2] << 8) | buf[3]);
-    az = (int16_t)((buf[4] << 8) | buf[5]);
+    ax = wordAt(ACCEL_PLAN, buf, ACCEL_XOUT_H::address);
+    ay = wordAt(ACCEL_PLAN, buf, ACCEL_YOUT_H::address);
+    az = wordAt(ACCEL_PLAN, buf, ACCEL_ZOUT_H::address);
 
     return true;
 }
 
 bool MPU9250_HAL::readGyroRaw(int16_t &gx, int16_t &gy, int16_t &gz) 
 {
-    uint8_t buf[6];
-    if(!readBytes(GYRO_XOUT_H, buf, 6)) 
+    uint8_t buf[planBytes(GYRO_PLAN)];
+    if(!readPlan(GYRO_PLAN, buf)) 
     {
         return false;
     }
 
-    gx = (int16_t)((buf[0] << 8) | buf[1]);
-    gy = (int16_t)((buf[2] << 8) | buf[3]);
-    gz = (int16_t)((buf[4] << 8) | buf[5]);
+    gx = wordAt(GYRO_PLAN, buf, GYRO_XOUT_H::address);
+    gy = wordAt(GYRO_PLAN, buf, GYRO_YOUT_H::address);
+    gz = wordAt(GYRO_PLAN, buf, GYRO_ZOUT_H::address);
 
     return true;
 }
 
 bool MPU9250_HAL::readTempRaw(int16_t &temp) 
 {
-    uint8_t buf[2];
+    uint8_t buf[planBytes(TEMP_PLAN)];
 
-    if (!readBytes(TEMP_OUT_H, buf, 2))
+    if (!readPlan(TEMP_PLAN, buf))
     {
         return false;
     }
-    temp = (int16_t)((buf[0] << 8) | buf[1]);
+    temp = wordAt(TEMP_PLAN, buf, TEMP_OUT_H::address);
 
     return true;
 }
@@ -183,23 +453,22 @@ bool MPU9250_HAL::readAllRaw(int16_t &ax, int16_t &ay, int16_t &az,
                              int16_t &gx, int16_t &gy, int16_t &gz,
                              int16_t &temp)
 {
-    // read 14 bytes ACCEL..TEMP..GYRO
-    uint8_t buf[14];
-    if(!readBytes(ACCEL_XOUT_H, buf, 14)) 
+    // ACCEL..TEMP..GYRO in the single burst the plan produced
+    uint8_t buf[planBytes(ALL_PLAN)];
+    if(!readPlan(ALL_PLAN, buf)) 
     {
         return false;
     }
 
-    ax = (int16_t)((buf[0] << 8) | buf[1]);
-    ay = (int16_t)((buf[2] << 8) | buf[3]);
-    az = (int16_t)((buf[4] << 8) | buf[5]);
+    ax = wordAt(ALL_PLAN, buf, ACCEL_XOUT_H::address);
+    ay = wordAt(ALL_PLAN, buf, ACCEL_YOUT_H::address);
+    az = wordAt(ALL_PLAN, buf, ACCEL_ZOUT_H::address);
 
-    // buf[6..7] for temp
-    temp = (int16_t)((buf[6]<< 8) | buf[7]);
+    temp = wordAt(ALL_PLAN, buf, TEMP_OUT_H::address);
 
-    gx = (int16_t)((buf[8] << 8) | buf[9]);
-    gy = (int16_t)((buf[10] << 8) | buf[11]);
-    gz = (int16_t)((buf[12] << 8) | buf[13]);
+    gx = wordAt(ALL_PLAN, buf, GYRO_XOUT_H::address);
+    gy = wordAt(ALL_PLAN, buf, GYRO_YOUT_H::address);
+    gz = wordAt(ALL_PLAN, buf, GYRO_ZOUT_H::address);
 
     return true;
 }
@@ -207,7 +476,8 @@ bool MPU9250_HAL::readAllRaw(int16_t &ax, int16_t &ay, int16_t &az,
 
 bool MPU9250_HAL::initAK8963() 
 {
-    if (!writeByte(INT_PIN_CFG, 0x02)) // BYPASS_EN
+    /* Sets BYPASS_EN in the INT_PIN_CFG shadow, keeping its other bits */
+    if (!writeReg(BYPASS_VALUE))
     {
         return false;
     }
@@ -222,7 +492,7 @@ bool MPU9250_HAL::readMagRaw(int16_t &mx, int16_t &my, int16_t &mz)
         return false;
     }
 
-    uint8_t reg = AK8963_XOUT_L;
+    uint8_t reg = AK8963_HXL::address;
     int ret = i2c_write_blocking(i2c_, AK8963_DEFAULT_ADDRESS, &reg, 1, true);
     if (ret < 0)
     {
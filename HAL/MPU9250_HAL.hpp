@@ -30,6 +30,26 @@
 #include "hardware/i2c.h"
 /* ******************************************************************************************** */
 
+/* Bytes in the shadowed configuration block (SMPLRT_DIV .. ACCEL_CONFIG2) */
+constexpr size_t MPU9250_CONFIG_BYTES = 5;
+
+/* Gyro start-up time after wake; its output is not valid before */
+constexpr uint32_t MPU9250_GYRO_SETTLE_US = 35000;
+
+/**
+ * @enum  :InitState
+ * @brief :Progress of the non-blocking initialization state machine.
+ */
+enum class InitState : uint8_t
+{
+    IDLE,       // startInit() not called yet
+    RESETTING,  // H_RESET written, polling PWR_MGMT_1 until it clears
+    WAKING,     // wake written, polling until SLEEP clears, then loading config
+    WAIT_DATA,  // config verified, waiting for accel data and the gyro to settle
+    READY,      // first valid accel + gyro sample available
+    FAILED      // bus error or timeout
+};
+
 /**
  * @class :MPU9250_HAL
  * @brief :Hardware Abstraction Layer for MPU9250 sensor.
@@ -69,7 +89,7 @@ class MPU9250_HAL
     /**
      * @brief :Test connection to the MPU9250.
      * 
-     * Reads the WHO_AM_I register (0x75) and verifies the device ID (expected: 0x71, 0x72, 0x73).
+     * Reads the WHO_AM_I register (0x75) and verifies the device ID (expected: 0x70, 0x71, 0x73).
      * 
      * @return :true if connection is valid, false otherwise.
      */
@@ -80,11 +100,142 @@ class MPU9250_HAL
      * 
      * Performs a device reset, sets clock source, and enables basic sensor operation
      * (e.g., via PWR_MGMT_1, SMPLRT_DIV, CONFIG, etc.).
+     * Blocking wrapper around startInit()/pollInit(): it polls the device for
+     * reset completion and the first sample instead of sleeping. Idempotent: if
+     * the device is already awake with the shadowed configuration, no reset is
+     * issued and it returns immediately.
      * 
      * @return t:rue if initialization succeeded, false otherwise.
      */
     bool initMPU9250(); // edit
 
+    /**
+     * @brief :Start the non-blocking initialization.
+     * 
+     * @param force :Reset even if the device already holds the shadowed configuration
+     *               (always the case after FAILED).
+     * @return :true if started (or already ready / in progress), false on bus error.
+     */
+    bool startInit(bool force);
+
+    /**
+     * @brief :Advance the initialization by at most one bus poll.
+     * 
+     * Call repeatedly (e.g., from the main loop) until READY or FAILED.
+     * 
+     * @return :Current state.
+     */
+    InitState pollInit();
+
+    /**
+     * @brief :Current initialization state.
+     */
+    InitState initState() const { return initState_; }
+
+    /**
+     * @brief :Time from startInit() to the first valid sample, in microseconds.
+     * 
+     * A sample is valid once the accel reads non-zero and the gyro reads
+     * non-zero at least MPU9250_GYRO_SETTLE_US after wake.
+     * 
+     * @return :Duration, or 0 if not READY (also 0 when startInit() skipped the reset).
+     */
+    uint32_t initDuration_us() const;
+
+    /**
+     * @brief :Change output data rate and filters without a reinit.
+     * 
+     * Updates SMPLRT_DIV, CONFIG.DLPF_CFG and ACCEL_CONFIG2.A_DLPF_CFG in the
+     * configuration shadow and writes the block in a single transaction, only
+     * if something changed. Other fields in those registers are preserved.
+     * 
+     * @param divider :SMPLRT_DIV value; ODR = 1 kHz / (1 + divider).
+     * @param gyroDlpf :Gyro/temperature DLPF bandwidth.
+     * @param accelDlpf :Accelerometer DLPF bandwidth.
+     * @param bytesWritten :Optional; set to the bytes sent to the device (0 when the shadow already matched).
+     * @return :true if the device holds the requested rate, false on bus error.
+     */
+    bool setSampleRate(uint8_t divider, MPU9250Reg::GyroDlpf gyroDlpf, MPU9250Reg::AccelDlpf accelDlpf,
+                       size_t* bytesWritten = nullptr);
+
+    /**
+     * @brief :Enter accel-only low-power cycling with the wake-on-motion interrupt.
+     * 
+     * Disables the gyro, sets the accel DLPF the WOM logic expects, enables
+     * the WOM interrupt (latched on INT until INT_STATUS is read), loads the
+     * threshold and wake-up rate, sets CYCLE, and finally reads INT_STATUS so
+     * a stale latch cannot hide the next edge. The configuration shadow and
+     * the other INT_PIN_CFG bits (e.g. BYPASS_EN) are untouched and restored
+     * by exitWakeOnMotion().
+     * 
+     * @param threshold_mg :Motion threshold in mg (4 mg per LSB, clamped to 1020 mg).
+     * @param wakeRate :Accel sample rate while cycling.
+     * @return :true if every write succeeded, false on bus error.
+     */
+    bool enterWakeOnMotion(uint16_t threshold_mg, MPU9250Reg::LpAccelOdr wakeRate);
+
+    /**
+     * @brief :Leave cycle mode and restore full-rate accel and gyro operation.
+     * 
+     * Clears CYCLE, re-enables the gyro, disables the WOM logic and interrupt,
+     * restores INT_PIN_CFG and rewrites the shadowed configuration block. The gyro needs about
+     * 35 ms after this before its output is valid.
+     * 
+     * @return :true if every write succeeded, false on bus error.
+     */
+    bool exitWakeOnMotion();
+
+    /**
+     * @brief :Write a composed register value, changing only the fields it names.
+     * 
+     * The register address comes from the value's type, so only values built
+     * from that register's own fields can be written to it. Bits outside
+     * value.mask keep their content: taken from the HAL's shadow for the
+     * SMPLRT_DIV .. ACCEL_CONFIG2 block and INT_PIN_CFG (which is updated
+     * too), otherwise read from the device first. A whole() value is written
+     * as is, without the read.
+     * 
+     * @param value :Value built from MPU9250Reg fields (e.g. CONFIG::DLPF_CFG(...)).
+     * @return :true if write succeeded, false otherwise (also for a partial
+     *          write to a write-only register, which cannot be read back).
+     */
+    template <typename R>
+    bool writeReg(MPU9250Reg::Value<R> value)
+    {
+        static_assert(R::access != MPU9250Reg::Access::READ_ONLY, "register is read-only");
+
+        uint8_t *shadow = shadowOf(R::address);
+        if(shadow != nullptr)
+        {
+            const uint8_t next = value.applyTo(*shadow);
+            if(!writeByte(R::address, next))
+            {
+                return false;
+            }
+            *shadow = next;
+            return true;
+        }
+        if(value.mask == 0xFF)
+        {
+            return writeByte(R::address, value.bits);
+        }
+
+        uint8_t current;
+        if((R::access == MPU9250Reg::Access::WRITE_ONLY) || !readBytes(R::address, &current, 1))
+        {
+            return false;
+        }
+        return writeByte(R::address, value.applyTo(current));
+    }
+
+    /**
+     * @brief :Read INT_STATUS, which also clears it and releases a latched INT pin.
+     * 
+     * @param status :Reference to store the status byte (see MPU9250Reg::INT_STATUS).
+     * @return :true if read succeeded, false otherwise.
+     */
+    bool readIntStatus(uint8_t &status);
+
     /**
      * @brief :Initialize the AK8963 magnetometer.
      * 
@@ -164,6 +315,13 @@ class MPU9250_HAL
     uint8_t address_;
     bool i2c_configured_;
 
+    InitState initState_;
+    uint32_t initStart_us_;
+    uint32_t initWake_us_;
+    uint32_t initDone_us_;
+    uint8_t shadow_[MPU9250_CONFIG_BYTES]; // intended SMPLRT_DIV .. ACCEL_CONFIG2
+    uint8_t intPinCfg_;                    // INT_PIN_CFG outside wake-on-motion
+
     /* ******************************** Helper Function ************************************ */
     /**
      * @brief :Write a single byte to a register.
@@ -176,6 +334,26 @@ class MPU9250_HAL
     * */
     bool writeByte(uint8_t reg, uint8_t value);
 
+    /**
+     * @brief :Write consecutive registers in one transaction.
+     * 
+     * @param reg :First register address.
+     * @param data :Values to write.
+     * @param len :Number of bytes (at most MPU9250_CONFIG_BYTES).
+     * @return :true if write succeeded, false otherwise.
+    * */
+    bool writeBytes(uint8_t reg, const uint8_t* data, size_t len);
+
+    /**
+     * @brief :true if the device is awake and holds the shadowed configuration.
+    * */
+    bool configMatches();
+
+    /**
+     * @brief :Shadow byte holding the intended content of reg, or nullptr if not shadowed.
+    * */
+    uint8_t *shadowOf(uint8_t reg);
+
     /**
      * @brief :Read multiple bytes from a register.
      * 
@@ -187,6 +365,39 @@ class MPU9250_HAL
      * @return :true if read succeeded, false otherwise.
     * */
     bool readBytes(uint8_t reg, uint8_t* buffer, size_t len); // edit c++
+
+    /**
+     * @brief :Read a burst span (see MPU9250Reg::spanOf).
+     * 
+     * @param span :First register and byte count.
+     * @param buffer :Buffer of at least span.length bytes.
+     * @return :true if read succeeded, false otherwise.
+    * */
+    bool readSpan(const MPU9250Reg::ReadSpan &span, uint8_t* buffer)
+    {
+        return readBytes(span.first, buffer, span.length);
+    }
+
+    /**
+     * @brief :Execute a MPU9250Reg::planReads() plan, one transaction per span.
+     * 
+     * @param plan :Plan built at compile time from the registers a caller needs.
+     * @param buffer :Buffer of at least planBytes(plan) bytes; see planOffset().
+     * @return :true if every span was read, false otherwise.
+    * */
+    template <size_t N>
+    bool readPlan(const MPU9250Reg::ReadPlan<N> &plan, uint8_t* buffer)
+    {
+        for (size_t i = 0; i < plan.count; i++)
+        {
+            if(!readSpan(plan.spans[i], buffer))
+            {
+                return false;
+            }
+            buffer += plan.spans[i].length;
+        }
+        return true;
+    }
 };
 
 #endif // MPU9250_HAL_HPP
@@ -1,85 +1,578 @@
 #ifndef MPU9250_REGISTERS_HPP
 #define MPU9250_REGISTERS_HPP
 
-/* Search: const expresion*/
+#include <cstdint>
+#include <cstddef>
+#include <array>
 
 /* Default I2C address for MPU6500 (part of MPU9250)*/
-#define MPU6500_DEFAULT_ADDRESS 0x68
-/* Device identification register(to verify access to MPU-9250) */
-#define WHO_AM_I        0x75
-/* Controls power modes, reset, clock source, and sleep/cycle status */
-#define PWR_MGMT_1      0x6B  
+constexpr uint8_t MPU6500_DEFAULT_ADDRESS = 0x68;
+/* Default I2C address for AK8963 magnetometer */
+constexpr uint8_t AK8963_DEFAULT_ADDRESS  = 0x0C;
+
+/*
+ * Type-safe register map.
+ *
+ * Every register is a type carrying its address and access rules. Its
+ * bitfields are Field objects: calling a field with a (typed) value yields a
+ * Value<Register> holding the shifted bits and the field mask. Values of the
+ * same register compose with `|`; values of different registers do not
+ * compile. Everything is constexpr, so a whole configuration folds to
+ * constant bytes:
+ *
+ *     constexpr auto cfg = CONFIG::DLPF_CFG(GyroDlpf::BW_41HZ);   // cfg.bits == 0x03
+ *     hal.writeReg(cfg);            // updates DLPF_CFG, keeps FIFO_MODE and EXT_SYNC_SET
+ *     hal.writeReg(cfg.whole());    // CONFIG = 0x03
+ */
+namespace MPU9250Reg
+{
+/* ******************************** Descriptors ************************************ */
+
+/* How a register may be accessed */
+enum class Access : uint8_t
+{
+    READ_WRITE,
+    READ_ONLY,
+    WRITE_ONLY
+};
+
+/**
+ * @brief :Register descriptor.
+ *
+ * @tparam Address :Register address.
+ * @tparam Acc     :Access rule.
+ * @tparam Burst   :true if a burst read starting here auto-increments into
+ *                  the next address (false for FIFO_R_W, which repeats).
+ */
+template <uint8_t Address, Access Acc = Access::READ_WRITE, bool Burst = true>
+struct Register
+{
+    static constexpr uint8_t address       = Address;
+    static constexpr Access  access        = Acc;
+    static constexpr bool    burstReadable = Burst;
+};
+
+/**
+ * @brief :Bits destined for register R, plus the mask of the fields they set.
+ *
+ * The mask lets the HAL do read-modify-write updates that only touch the
+ * composed fields. whole() marks a value that sets the entire register.
+ */
+template <typename R>
+struct Value
+{
+    uint8_t bits;
+    uint8_t mask;
+
+    constexpr Value operator|(Value other) const
+    {
+        return Value{(uint8_t)(bits | other.bits), (uint8_t)(mask | other.mask)};
+    }
+
+    /* Apply onto a previous register content, keeping the untouched bits */
+    constexpr uint8_t applyTo(uint8_t current) const
+    {
+        return (uint8_t)((current & ~mask) | bits);
+    }
+
+    /* The same bits as a whole-register value: fields not composed are written as 0 */
+    constexpr Value whole() const
+    {
+        return Value{bits, 0xFF};
+    }
+};
+
+/**
+ * @brief :Bitfield of register R occupying bits [Shift + Width - 1 : Shift].
+ *
+ * @tparam T :Accepted value type (bool, uint8_t or a field enum).
+ */
+template <typename R, uint8_t Shift, uint8_t Width, typename T = uint8_t>
+struct Field
+{
+    static_assert((Shift + Width) <= 8, "field must fit in an 8-bit register");
+
+    static constexpr uint8_t mask = (uint8_t)(((1u << Width) - 1u) << Shift);
+
+    constexpr Value<R> operator()(T v) const
+    {
+        return Value<R>{(uint8_t)(((uint8_t)v << Shift) & mask), mask};
+    }
+};
+
+/* ******************************** Field enums ************************************ */
+
+/* PWR_MGMT_1.CLKSEL */
+enum class ClockSource : uint8_t
+{
+    INTERNAL_20MHZ = 0,
+    AUTO_PLL       = 1, // PLL when ready, else internal oscillator
+    STOP           = 7
+};
+
+/* CONFIG.DLPF_CFG (with GYRO_CONFIG.FCHOICE_B = 0): gyro bandwidth */
+enum class GyroDlpf : uint8_t
+{
+    BW_250HZ  = 0,
+    BW_184HZ  = 1,
+    BW_92HZ   = 2,
+    BW_41HZ   = 3,
+    BW_20HZ   = 4,
+    BW_10HZ   = 5,
+    BW_5HZ    = 6,
+    BW_3600HZ = 7
+};
+
+/* ACCEL_CONFIG2.A_DLPF_CFG (with ACCEL_FCHOICE_B = 0): accel bandwidth */
+enum class AccelDlpf : uint8_t
+{
+    BW_218HZ = 0, // 1 selects the same bandwidth
+    BW_99HZ  = 2,
+    BW_45HZ  = 3,
+    BW_21HZ  = 4,
+    BW_10HZ  = 5,
+    BW_5HZ   = 6,
+    BW_420HZ = 7
+};
+
+/* GYRO_CONFIG.GYRO_FS_SEL */
+enum class GyroFullScale : uint8_t
+{
+    DPS_250  = 0,
+    DPS_500  = 1,
+    DPS_1000 = 2,
+    DPS_2000 = 3
+};
+
+/* ACCEL_CONFIG.ACCEL_FS_SEL: Acceleration range */
+enum class AccelFullScale : uint8_t
+{
+    G_2  = 0,
+    G_4  = 1,
+    G_8  = 2,
+    G_16 = 3
+};
+
+/* LP_ACCEL_ODR.LPOSC_CLKSEL: wake-up rate in accel-only cycle mode */
+enum class LpAccelOdr : uint8_t
+{
+    HZ_0_24 = 0,
+    HZ_0_49 = 1,
+    HZ_0_98 = 2,
+    HZ_1_95 = 3,
+    HZ_3_91 = 4,
+    HZ_7_81 = 5,
+    HZ_15_63 = 6,
+    HZ_31_25 = 7,
+    HZ_62_50 = 8,
+    HZ_125   = 9,
+    HZ_250   = 10,
+    HZ_500   = 11
+};
+
+/* ******************************** MPU6500 registers ************************************ */
+
 /* Sets the sample rate divider to control the output data rate */
-#define SMPLRT_DIV      0x19
+struct SMPLRT_DIV : Register<0x19>
+{
+    static constexpr Field<SMPLRT_DIV, 0, 8> DIVIDER{}; // ODR = 1 kHz / (1 + DIVIDER)
+};
+
 /* Configures FIFO behavior, digital low-pass filter for Gyro and temperature*/
-#define CONFIG          0x1A
+struct CONFIG : Register<0x1A>
+{
+    static constexpr Field<CONFIG, 6, 1, bool>     FIFO_MODE{};
+    static constexpr Field<CONFIG, 3, 3>           EXT_SYNC_SET{};
+    static constexpr Field<CONFIG, 0, 3, GyroDlpf> DLPF_CFG{};
+};
+
+/* Gyro full scale and DLPF bypass */
+struct GYRO_CONFIG : Register<0x1B>
+{
+    static constexpr Field<GYRO_CONFIG, 3, 2, GyroFullScale> GYRO_FS_SEL{};
+    static constexpr Field<GYRO_CONFIG, 0, 2>                FCHOICE_B{};
+};
+
+/* Accel full scale */
+struct ACCEL_CONFIG : Register<0x1C>
+{
+    static constexpr Field<ACCEL_CONFIG, 3, 2, AccelFullScale> ACCEL_FS_SEL{};
+};
+
 /* Configures DLPF bypass for Accelerometer */
-#define ACCEL_CONFIG2   0x1D
+struct ACCEL_CONFIG2 : Register<0x1D>
+{
+    static constexpr Field<ACCEL_CONFIG2, 3, 1, bool>      ACCEL_FCHOICE_B{};
+    static constexpr Field<ACCEL_CONFIG2, 0, 3, AccelDlpf> A_DLPF_CFG{};
+};
 
+/* Wake-up frequency in accel-only low power mode */
+struct LP_ACCEL_ODR : Register<0x1E>
+{
+    static constexpr Field<LP_ACCEL_ODR, 0, 4, LpAccelOdr> LPOSC_CLKSEL{};
+};
 
-/* Sets interrupt pin polarity */
-#define INT_PIN_CFG     0x37
-/* Enables/disables interrupts */
-#define INT_ENABLE      0x38
+/* Wake-on-motion threshold, 4 mg per LSB */
+struct WOM_THR : Register<0x1F>
+{
+    static constexpr Field<WOM_THR, 0, 8> WOM_THRESHOLD{};
+};
 
-/* Upper byte of acceleration measurement on X-axis */
-#define ACCEL_XOUT_H    0x3B
-/* Lower byte of acceleration measurement on X-axis */
-#define ACCEL_XOUT_L    0x3C
+/* Selects which sensor data is written to the FIFO */
+struct FIFO_EN : Register<0x23>
+{
+    static constexpr Field<FIFO_EN, 7, 1, bool> TEMP_OUT{};
+    static constexpr Field<FIFO_EN, 4, 3>       GYRO_XYZ{};
+    static constexpr Field<FIFO_EN, 3, 1, bool> ACCEL{};
+    static constexpr Field<FIFO_EN, 0, 1, bool> SLV_0{};
+};
+
+/* Configures I2C Master mode */
+struct I2C_MST_CTRL : Register<0x24>
+{
+    static constexpr Field<I2C_MST_CTRL, 0, 4> I2C_MST_CLK{};
+};
 
-#define ACCEL_YOUT_H    0x3D
+/* ets I2C address and read/write for Slave 4 */
+struct I2C_SLV4_ADDR : Register<0x31>
+{
+    static constexpr Field<I2C_SLV4_ADDR, 7, 1, bool> I2C_SLV4_RNW{};
+    static constexpr Field<I2C_SLV4_ADDR, 0, 7>       I2C_ID_4{};
+};
+
+/* Enables Slave 4, controls data transfer */
+struct I2C_SLV4_CTRL : Register<0x34>
+{
+    static constexpr Field<I2C_SLV4_CTRL, 7, 1, bool> I2C_SLV4_EN{};
+    static constexpr Field<I2C_SLV4_CTRL, 6, 1, bool> SLV4_DONE_INT_EN{};
+    static constexpr Field<I2C_SLV4_CTRL, 0, 5>       I2C_MST_DLY{};
+};
+
+/* Sets interrupt pin polarity */
+struct INT_PIN_CFG : Register<0x37>
+{
+    static constexpr Field<INT_PIN_CFG, 7, 1, bool> ACTL{};
+    static constexpr Field<INT_PIN_CFG, 6, 1, bool> OPEN{};
+    static constexpr Field<INT_PIN_CFG, 5, 1, bool> LATCH_INT_EN{};
+    static constexpr Field<INT_PIN_CFG, 4, 1, bool> INT_ANYRD_2CLEAR{};
+    static constexpr Field<INT_PIN_CFG, 1, 1, bool> BYPASS_EN{};
+};
 
-#define ACCEL_YOUT_L    0x3E
+/* Enables/disables interrupts */
+struct INT_ENABLE : Register<0x38>
+{
+    static constexpr Field<INT_ENABLE, 6, 1, bool> WOM_EN{};
+    static constexpr Field<INT_ENABLE, 4, 1, bool> FIFO_OFLOW_EN{};
+    static constexpr Field<INT_ENABLE, 3, 1, bool> FSYNC_INT_EN{};
+    static constexpr Field<INT_ENABLE, 0, 1, bool> RAW_RDY_EN{};
+};
 
-#define ACCEL_ZOUT_H    0x3F
+/* Interrupt status, cleared by reading */
+struct INT_STATUS : Register<0x3A, Access::READ_ONLY>
+{
+    static constexpr Field<INT_STATUS, 6, 1, bool> WOM_INT{};
+    static constexpr Field<INT_STATUS, 4, 1, bool> FIFO_OFLOW_INT{};
+    static constexpr Field<INT_STATUS, 0, 1, bool> RAW_DATA_RDY_INT{};
+};
 
-#define ACCEL_ZOUT_L    0x40
+/* Upper byte of acceleration measurement on X-axis */
+struct ACCEL_XOUT_H : Register<0x3B, Access::READ_ONLY> {};
+/* Lower byte of acceleration measurement on X-axis */
+struct ACCEL_XOUT_L : Register<0x3C, Access::READ_ONLY> {};
+struct ACCEL_YOUT_H : Register<0x3D, Access::READ_ONLY> {};
+struct ACCEL_YOUT_L : Register<0x3E, Access::READ_ONLY> {};
+struct ACCEL_ZOUT_H : Register<0x3F, Access::READ_ONLY> {};
+struct ACCEL_ZOUT_L : Register<0x40, Access::READ_ONLY> {};
 
 /* Upper byte of temperature measuremen */
-#define TEMP_OUT_H      0x41
+struct TEMP_OUT_H : Register<0x41, Access::READ_ONLY> {};
 /* Lower byte of temperature measurement */
-#define TEMP_OUT_L      0x42
+struct TEMP_OUT_L : Register<0x42, Access::READ_ONLY> {};
 
 /* Upper byte of rotation measurement on X-axis */
-#define GYRO_XOUT_H     0x43
+struct GYRO_XOUT_H : Register<0x43, Access::READ_ONLY> {};
 /* Lower byte of rotation measurement on X-axis */
-#define GYRO_XOUT_L     0x44
+struct GYRO_XOUT_L : Register<0x44, Access::READ_ONLY> {};
+struct GYRO_YOUT_H : Register<0x45, Access::READ_ONLY> {};
+struct GYRO_YOUT_L : Register<0x46, Access::READ_ONLY> {};
+struct GYRO_ZOUT_H : Register<0x47, Access::READ_ONLY> {};
+struct GYRO_ZOUT_L : Register<0x48, Access::READ_ONLY> {};
 
-#define GYRO_YOUT_H     0x45
+/* First byte read from external sensors by the I2C master */
+struct EXT_SENS_DATA_00 : Register<0x49, Access::READ_ONLY> {};
 
-#define GYRO_YOUT_L     0x46
+/* Wake-on-motion detection logic */
+struct MOT_DETECT_CTRL : Register<0x69>
+{
+    static constexpr Field<MOT_DETECT_CTRL, 7, 1, bool> ACCEL_INTEL_EN{};
+    static constexpr Field<MOT_DETECT_CTRL, 6, 1, bool> ACCEL_INTEL_MODE{};
+};
 
-#define GYRO_ZOUT_H     0x47
+/* Control enables/disables FIFO and I2C Master function */
+struct USER_CTRL : Register<0x6A>
+{
+    static constexpr Field<USER_CTRL, 6, 1, bool> FIFO_EN{};
+    static constexpr Field<USER_CTRL, 5, 1, bool> I2C_MST_EN{};
+    static constexpr Field<USER_CTRL, 4, 1, bool> I2C_IF_DIS{};
+    static constexpr Field<USER_CTRL, 2, 1, bool> FIFO_RST{};
+    static constexpr Field<USER_CTRL, 1, 1, bool> I2C_MST_RST{};
+    static constexpr Field<USER_CTRL, 0, 1, bool> SIG_COND_RST{};
+};
 
-#define GYRO_ZOUT_L     0x48
+/* Controls power modes, reset, clock source, and sleep/cycle status */
+struct PWR_MGMT_1 : Register<0x6B>
+{
+    static constexpr Field<PWR_MGMT_1, 7, 1, bool>        H_RESET{}; // device reset, self-clearing
+    static constexpr Field<PWR_MGMT_1, 6, 1, bool>        SLEEP{};
+    static constexpr Field<PWR_MGMT_1, 5, 1, bool>        CYCLE{};
+    static constexpr Field<PWR_MGMT_1, 4, 1, bool>        GYRO_STANDBY{};
+    static constexpr Field<PWR_MGMT_1, 3, 1, bool>        PD_PTAT{};
+    static constexpr Field<PWR_MGMT_1, 0, 3, ClockSource> CLKSEL{};
+};
 
-/* Control enables/disables FIFO and I2C Master function */
-#define USER_CTRL       0x6A
-/* Configures I2C Master mode */
-#define I2C_MST_CTRL    0x24
-/* Enables Slave 4, controls data transfer */
-#define I2C_SLV4_CTRL   0x34
-/* ets I2C address and read/write for Slave 4 */
-#define I2C_SLV4_ADDR   0x31
+/* Per-axis accel/gyro disable */
+struct PWR_MGMT_2 : Register<0x6C>
+{
+    static constexpr Field<PWR_MGMT_2, 3, 3> DISABLE_ACCEL_XYZ{};
+    static constexpr Field<PWR_MGMT_2, 0, 3> DISABLE_GYRO_XYZ{};
+};
 
-/* Default I2C address for AK8963 magnetometer */
-#define AK8963_DEFAULT_ADDRESS 0x0C
+/* FIFO byte count, high byte first */
+struct FIFO_COUNTH : Register<0x72, Access::READ_ONLY> {};
+struct FIFO_COUNTL : Register<0x73, Access::READ_ONLY> {};
+/* FIFO data port: repeated reads pop successive bytes, no auto-increment */
+struct FIFO_R_W : Register<0x74, Access::READ_WRITE, false> {};
+
+/* Device identification register(to verify access to MPU-9250) */
+struct WHO_AM_I : Register<0x75, Access::READ_ONLY> {};
+
+/* ******************************** AK8963 registers ************************************ */
+
+/* Device ID, reads 0x48 */
+struct AK8963_WIA  : Register<0x00, Access::READ_ONLY> {};
+/* Data ready status */
+struct AK8963_ST1  : Register<0x02, Access::READ_ONLY> {};
 /* Lower byte of magnetic field measurement on X-axis */
-#define AK8963_XOUT_L 0x03
+struct AK8963_HXL  : Register<0x03, Access::READ_ONLY> {};
+/* Overflow status; must be read to release the data registers */
+struct AK8963_ST2  : Register<0x09, Access::READ_ONLY> {};
+/* Operating mode and output bit depth */
+struct AK8963_CNTL1 : Register<0x0A>
+{
+    static constexpr Field<AK8963_CNTL1, 4, 1, bool> BIT_16{};
+    static constexpr Field<AK8963_CNTL1, 0, 4>       MODE{};
+};
+
+/* ******************************** Burst planning ************************************ */
+
+/* Expected WHO_AM_I values (MPU9250 / MPU9255 / MPU6500) */
+constexpr uint8_t WHO_AM_I_MPU9250 = 0x71;
+constexpr uint8_t WHO_AM_I_MPU9255 = 0x73;
+constexpr uint8_t WHO_AM_I_MPU6500 = 0x70;
+
+/**
+ * @brief :A single burst read: `length` bytes starting at `first`.
+ */
+struct ReadSpan
+{
+    uint8_t first;
+    uint8_t length;
+};
+
+/*
+ * Address ranges that auto-increment across every register inside them and
+ * can therefore be fetched with one burst. The sensor output registers run
+ * straight into EXT_SENS_DATA_00..23.
+ */
+constexpr ReadSpan BURST_BLOCKS[] =
+{
+    {0x19, 0x1F - 0x19 + 1},  // SMPLRT_DIV .. WOM_THR
+    {0x3A, 0x60 - 0x3A + 1},  // INT_STATUS .. EXT_SENS_DATA_23
+    {0x72, 2},                // FIFO_COUNTH .. FIFO_COUNTL
+};
+
+/* true if [first, first + length) lies inside one burst block */
+constexpr bool isBurstContiguous(uint8_t first, uint8_t length)
+{
+    for (const ReadSpan &b : BURST_BLOCKS)
+    {
+        if ((first >= b.first) && ((first + length) <= (b.first + b.length)))
+        {
+            return true;
+        }
+    }
+    return length <= 1;
+}
+
+/**
+ * @brief :Compile-time span covering registers First..Last (inclusive).
+ *
+ * Fails to compile if the range cannot be read in one burst.
+ */
+template <typename First, typename Last>
+constexpr ReadSpan spanOf()
+{
+    static_assert(Last::address >= First::address, "span must run upwards");
+    static_assert(First::burstReadable, "span must start at a burst-readable register");
+    static_assert(isBurstContiguous(First::address, Last::address - First::address + 1),
+                  "registers are not in one contiguous burst block");
+    return ReadSpan{First::address, (uint8_t)(Last::address - First::address + 1)};
+}
+
+/**
+ * @brief :Minimal set of burst reads covering a set of registers.
+ */
+template <size_t N>
+struct ReadPlan
+{
+    ReadSpan spans[N];
+    size_t   count;
+};
+
+/**
+ * @brief :Plan the fewest transactions that fetch every register in `regs`.
+ *
+ * Registers are sorted and merged whenever the merged range stays inside one
+ * burst block: reading a few unused bytes in the gap is cheaper on I2C than
+ * a new address/register/restart sequence. Usable at compile time.
+ */
+template <size_t N>
+constexpr ReadPlan<N> planReads(std::array<uint8_t, N> regs)
+{
+    for (size_t i = 1; i < N; i++)
+    {
+        for (size_t j = i; (j > 0) && (regs[j - 1] > regs[j]); j--)
+        {
+            uint8_t t   = regs[j];
+            regs[j]     = regs[j - 1];
+            regs[j - 1] = t;
+        }
+    }
+
+    ReadPlan<N> plan{};
+    for (size_t i = 0; i < N; i++)
+    {
+        if (plan.count > 0)
+        {
+            ReadSpan &last = plan.spans[plan.count - 1];
+            uint8_t length = (uint8_t)(regs[i] - last.first + 1);
+            if (regs[i] < (last.first + last.length))
+            {
+                continue; // duplicate
+            }
+            if (isBurstContiguous(last.first, length))
+            {
+                last.length = length;
+                continue;
+            }
+        }
+        plan.spans[plan.count] = ReadSpan{regs[i], 1};
+        plan.count++;
+    }
+    return plan;
+}
+
+/**
+ * @brief :Both bytes (H, then H + 1) of each 16-bit output register, for planReads().
+ */
+template <size_t N>
+constexpr std::array<uint8_t, 2 * N> wordRegs(std::array<uint8_t, N> high)
+{
+    std::array<uint8_t, 2 * N> regs{};
+    for (size_t i = 0; i < N; i++)
+    {
+        regs[2 * i]     = high[i];
+        regs[2 * i + 1] = (uint8_t)(high[i] + 1);
+    }
+    return regs;
+}
+
+/**
+ * @brief :Bytes a plan reads in total (its spans land back to back in one buffer).
+ */
+template <size_t N>
+constexpr size_t planBytes(const ReadPlan<N> &plan)
+{
+    size_t bytes = 0;
+    for (size_t i = 0; i < plan.count; i++)
+    {
+        bytes += plan.spans[i].length;
+    }
+    return bytes;
+}
+
+/**
+ * @brief :Position of register `reg` in the buffer filled by a plan.
+ *
+ * @return :Offset, or planBytes(plan) if the plan does not read `reg`.
+ */
+template <size_t N>
+constexpr size_t planOffset(const ReadPlan<N> &plan, uint8_t reg)
+{
+    size_t offset = 0;
+    for (size_t i = 0; i < plan.count; i++)
+    {
+        const ReadSpan &span = plan.spans[i];
+        if ((reg >= span.first) && (reg < (span.first + span.length)))
+        {
+            return offset + (reg - span.first);
+        }
+        offset += span.length;
+    }
+    return offset;
+}
+
+/* ******************************** Datasheet checks ************************************ */
 
-/********************************** Gyroscope Scales *********************************** */
-#define GYRO_FS_250  (0x00) 
-#define GYRO_FS_500  (0x08) 
-#define GYRO_FS_1000 (0x10)
-#define GYRO_FS_2000 (0x18) 
+static_assert(SMPLRT_DIV::address    == 0x19, "SMPLRT_DIV address");
+static_assert(CONFIG::address        == 0x1A, "CONFIG address");
+static_assert(GYRO_CONFIG::address   == 0x1B, "GYRO_CONFIG address");
+static_assert(ACCEL_CONFIG::address  == 0x1C, "ACCEL_CONFIG address");
+static_assert(ACCEL_CONFIG2::address == 0x1D, "ACCEL_CONFIG2 address");
+static_assert(INT_PIN_CFG::address   == 0x37, "INT_PIN_CFG address");
+static_assert(INT_ENABLE::address    == 0x38, "INT_ENABLE address");
+static_assert(PWR_MGMT_1::address    == 0x6B, "PWR_MGMT_1 address");
+static_assert(WHO_AM_I::address      == 0x75, "WHO_AM_I address");
 
-/************************************ Acceleration Scales [Acceleration Range] ******************************* */
+/* Accel, temp and gyro outputs are one 14-byte big-endian block */
+static_assert(TEMP_OUT_H::address  == ACCEL_ZOUT_L::address + 1, "TEMP follows ACCEL");
+static_assert(GYRO_XOUT_H::address == TEMP_OUT_L::address + 1,   "GYRO follows TEMP");
+static_assert(spanOf<ACCEL_XOUT_H, GYRO_ZOUT_L>().length == 14,  "sensor block is 14 bytes");
+static_assert(EXT_SENS_DATA_00::address == GYRO_ZOUT_L::address + 1, "EXT_SENS_DATA follows GYRO");
+static_assert(!FIFO_R_W::burstReadable, "FIFO_R_W does not auto-increment");
 
-#define ACCEL_FS_2G  (0x00)
-#define ACCEL_FS_4G  (0x08) 
-#define ACCEL_FS_8G  (0x10) 
-#define ACCEL_FS_16G (0x18) /* Acceleration range ±16 g*/
+/* Field layout */
+static_assert(PWR_MGMT_1::H_RESET(true).bits == 0x80, "H_RESET is bit 7");
+static_assert(PWR_MGMT_1::CLKSEL(ClockSource::AUTO_PLL).bits == 0x01, "CLKSEL is bits 2:0");
+static_assert(CONFIG::DLPF_CFG(GyroDlpf::BW_41HZ).bits == 0x03, "DLPF_CFG is bits 2:0");
+static_assert(GYRO_CONFIG::GYRO_FS_SEL(GyroFullScale::DPS_2000).bits == 0x18, "GYRO_FS_SEL is bits 4:3");
+static_assert(ACCEL_CONFIG::ACCEL_FS_SEL(AccelFullScale::G_16).bits == 0x18, "ACCEL_FS_SEL is bits 4:3");
+static_assert(INT_PIN_CFG::BYPASS_EN(true).bits == 0x02, "BYPASS_EN is bit 1");
+static_assert(INT_ENABLE::RAW_RDY_EN(true).bits == 0x01, "RAW_RDY_EN is bit 0");
+static_assert(CONFIG::DLPF_CFG(GyroDlpf::BW_41HZ).applyTo(0x50) == 0x53, "applyTo keeps the other fields");
+static_assert(CONFIG::DLPF_CFG(GyroDlpf::BW_41HZ).whole().applyTo(0x50) == 0x03, "whole() clears them");
+static_assert((CONFIG::FIFO_MODE.mask | CONFIG::EXT_SYNC_SET.mask | CONFIG::DLPF_CFG.mask) == 0x7F,
+              "CONFIG fields do not overlap");
+static_assert((PWR_MGMT_1::H_RESET.mask | PWR_MGMT_1::SLEEP.mask | PWR_MGMT_1::CYCLE.mask |
+               PWR_MGMT_1::GYRO_STANDBY.mask | PWR_MGMT_1::PD_PTAT.mask | PWR_MGMT_1::CLKSEL.mask) == 0xFF,
+              "PWR_MGMT_1 fields do not overlap");
+static_assert(FIFO_EN::address == 0x23, "FIFO_EN address");
+static_assert(FIFO_EN::TEMP_OUT(true).bits == 0x80, "TEMP_FIFO_EN is bit 7");
+static_assert(FIFO_EN::GYRO_XYZ(7).bits == 0x70, "GYRO_[XYZ]OUT are bits 6:4");
+static_assert(FIFO_EN::ACCEL(true).bits == 0x08, "ACCEL is bit 3");
+static_assert((FIFO_EN::TEMP_OUT.mask + FIFO_EN::GYRO_XYZ.mask + FIFO_EN::ACCEL.mask + FIFO_EN::SLV_0.mask) ==
+              (FIFO_EN::TEMP_OUT.mask | FIFO_EN::GYRO_XYZ.mask | FIFO_EN::ACCEL.mask | FIFO_EN::SLV_0.mask),
+              "FIFO_EN fields do not overlap");
+/* Temp + gyro + accel in the FIFO gives the 14-byte frame decodeFrames() expects */
+static_assert((FIFO_EN::TEMP_OUT(true) | FIFO_EN::GYRO_XYZ(7) | FIFO_EN::ACCEL(true)).bits == 0xF8,
+              "FIFO_EN 14-byte frame byte");
 
+/* Planner: accel + gyro collapse into one burst; WHO_AM_I needs its own */
+static_assert(planReads<3>({ACCEL_XOUT_H::address, GYRO_ZOUT_L::address, WHO_AM_I::address}).count == 2,
+              "planner merges contiguous registers");
+static_assert(planOffset(planReads<3>({WHO_AM_I::address, GYRO_ZOUT_L::address, ACCEL_XOUT_H::address}),
+                         WHO_AM_I::address) == 14, "spans are laid out in address order");
 
+} // namespace MPU9250Reg
 
 #endif // MPU9250_REGISTERS_HPP
@@ -0,0 +1,177 @@
+#include "MPU9250_AdaptiveRate.hpp"
+
+namespace
+{
+    /* Valid only for the DLPF settings tierTableValid() accepts */
+    inline float tierRate_hz(const RateTier &tier)
+    {
+        return 1000.0f / (1.0f + tier.divider);
+    }
+
+    bool tierTableValid(const AdaptiveRateConfig &config)
+    {
+        for (uint8_t t = 0; t < config.tierCount; t++)
+        {
+            /* SMPLRT_DIV only applies with DLPF_CFG 1..6; 0 and 7 run the gyro at 8 kHz */
+            const MPU9250Reg::GyroDlpf dlpf = config.tiers[t].gyroDlpf;
+            if ((dlpf == MPU9250Reg::GyroDlpf::BW_250HZ) || (dlpf == MPU9250Reg::GyroDlpf::BW_3600HZ))
+            {
+                return false;
+            }
+            if (t == 0)
+            {
+                continue;
+            }
+
+            if (config.tiers[t].divider > config.tiers[t - 1].divider)
+            {
+                return false; // slower than the tier below
+            }
+            if ((t >= 2) && !(config.tiers[t].enterEnergy > config.tiers[t - 1].enterEnergy))
+            {
+                return false; // tiers[0].enterEnergy is unused
+            }
+        }
+        return true;
+    }
+}
+
+float computeMotionEnergy(const AccelData &accel, const GyroData &gyro, float gyroWeight)
+{
+    const float a2 = accel.x_g * accel.x_g + accel.y_g * accel.y_g + accel.z_g * accel.z_g;
+    const float w2 = gyro.x_dps * gyro.x_dps + gyro.y_dps * gyro.y_dps + gyro.z_dps * gyro.z_dps;
+    const float accelTerm = (a2 > 1.0f) ? (a2 - 1.0f) : (1.0f - a2);
+    return accelTerm + gyroWeight * w2;
+}
+
+AdaptiveRateController::AdaptiveRateController(MPU9250_HAL &hal, const AdaptiveRateConfig &config)
+: hal_(hal),
+  config_(config),
+  valid_(false),
+  tier_(0),
+  quietCount_(0),
+  energy_(0.0f),
+  lastUpdate_us_(0),
+  timeInTier_us_(),
+  totalTime_us_(0),
+  transactions_(0),
+  switches_(0)
+{
+    if (config_.tierCount == 0)
+    {
+        config_.tierCount = 1;
+    }
+    if (config_.tierCount > ADAPTIVE_MAX_TIERS)
+    {
+        config_.tierCount = ADAPTIVE_MAX_TIERS;
+    }
+    valid_ = tierTableValid(config_);
+}
+
+bool AdaptiveRateController::begin(uint32_t now_us)
+{
+    if (!valid_)
+    {
+        return false;
+    }
+    lastUpdate_us_ = now_us;
+    quietCount_    = 0;
+    return applyTier(0);
+}
+
+bool AdaptiveRateController::applyTier(uint8_t tier)
+{
+    const RateTier &t = config_.tiers[tier];
+    size_t written = 0;
+    if (!hal_.setSampleRate(t.divider, t.gyroDlpf, t.accelDlpf, &written))
+    {
+        return false;
+    }
+    /* A tier whose registers already match costs no bus transaction */
+    if (written != 0)
+    {
+        transactions_++;
+    }
+    tier_ = tier;
+    return true;
+}
+
+bool AdaptiveRateController::update(const AccelData &accel, const GyroData &gyro, uint32_t now_us)
+{
+    if (!valid_)
+    {
+        return false;
+    }
+
+    /* Statistics for the interval that just ended, charged to the tier it ran at */
+    const uint32_t dt_us = now_us - lastUpdate_us_;
+    lastUpdate_us_ = now_us;
+    timeInTier_us_[tier_] += dt_us;
+    totalTime_us_ += dt_us;
+    transactions_++;
+
+    energy_ = computeMotionEnergy(accel, gyro, config_.gyroWeight);
+
+    /* Up: jump straight to the fastest tier whose threshold is met */
+    uint8_t wanted = tier_;
+    for (uint8_t t = tier_ + 1; t < config_.tierCount; t++)
+    {
+        if (energy_ >= config_.tiers[t].enterEnergy)
+        {
+            wanted = t;
+        }
+    }
+    if (wanted != tier_)
+    {
+        quietCount_ = 0;
+        if (applyTier(wanted))
+        {
+            switches_++;
+            return true;
+        }
+        return false;
+    }
+
+    /* Down: one tier at a time after holdSamples below the exit threshold */
+    if ((tier_ > 0) && (energy_ < config_.tiers[tier_].enterEnergy * config_.exitRatio))
+    {
+        quietCount_++;
+        if (quietCount_ >= config_.holdSamples)
+        {
+            quietCount_ = 0;
+            if (applyTier(tier_ - 1))
+            {
+                switches_++;
+                return true;
+            }
+        }
+    }
+    else
+    {
+        quietCount_ = 0;
+    }
+
+    return false;
+}
+
+uint32_t AdaptiveRateController::samplePeriod_us() const
+{
+    return 1000u * (1u + config_.tiers[tier_].divider);
+}
+
+uint64_t AdaptiveRateController::timeInTier_us(uint8_t tier) const
+{
+    if (tier >= config_.tierCount)
+    {
+        return 0;
+    }
+    return timeInTier_us_[tier];
+}
+
+uint32_t AdaptiveRateController::transactionsSaved() const
+{
+    /* Reads the fastest tier would have issued over the same time */
+    const double fullRateReads = totalTime_us_ * 1e-6 * tierRate_hz(config_.tiers[config_.tierCount - 1]);
+    const double saved = fullRateReads - transactions_;
+    return (saved > 0.0) ? (uint32_t)saved : 0u;
+}
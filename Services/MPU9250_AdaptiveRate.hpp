@@ -0,0 +1,164 @@
+/**
+ * @file  :MPU9250_AdaptiveRate.hpp
+ * @brief :Motion-adaptive output data rate control for the MPU9250.
+ *
+ * A fixed SMPLRT_DIV spends bus bandwidth and CPU at full rate even while
+ * the device sits still for hours. The AdaptiveRateController watches a
+ * cheap motion-energy metric computed from every sample and moves between
+ * configured ODR/DLPF tiers: up immediately (on the sample that crosses a
+ * threshold), down one tier at a time after a quiet hold period, with a
+ * hysteresis band in between. Rate changes go through
+ * MPU9250_HAL::setSampleRate(), never a full reinit.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef IMU_ADAPTIVE_RATE_HPP
+#define IMU_ADAPTIVE_RATE_HPP
+
+/****************************************** include part ********************************************* */
+#include "../HAL/MPU9250_HAL.hpp"
+#include "MPU9250_Service.hpp"
+#include <cstdint>
+/**************************************** User Data Types Part *************************************** */
+
+/* Maximum number of rate tiers */
+constexpr uint8_t ADAPTIVE_MAX_TIERS = 4;
+
+/**
+ * @struct :RateTier
+ * @brief  :One ODR/DLPF operating point.
+ */
+struct RateTier
+{
+    uint8_t                divider;     // SMPLRT_DIV; ODR = 1 kHz / (1 + divider)
+    MPU9250Reg::GyroDlpf   gyroDlpf;    // BW_184HZ..BW_5HZ: the divider is ignored at BW_250HZ/BW_3600HZ
+    MPU9250Reg::AccelDlpf  accelDlpf;
+    float                  enterEnergy; // motion energy at which this tier is selected
+};
+
+/**
+ * @struct :AdaptiveRateConfig
+ * @brief  :Tiers (slowest first) and switching behaviour.
+ */
+struct AdaptiveRateConfig
+{
+    uint8_t  tierCount;                  // 1..ADAPTIVE_MAX_TIERS
+    RateTier tiers[ADAPTIVE_MAX_TIERS];  // non-decreasing rate, strictly ascending enterEnergy; tiers[0].enterEnergy is ignored
+    float    exitRatio;                  // leave a tier below enterEnergy * exitRatio (0..1)
+    uint16_t holdSamples;                // consecutive quiet samples before stepping down
+    float    gyroWeight;                 // weight of |ω|² (dps²) against the accel term
+};
+/****************************************************************************************************** */
+/**
+ * @brief :Motion energy | |a|² - 1 | + gyroWeight * |ω|² of one sample.
+ *
+ * @param accel      :Accelerometer sample in g.
+ * @param gyro       :Gyroscope sample in dps.
+ * @param gyroWeight :Weight of |ω|² (dps²) against the accel term.
+ */
+float computeMotionEnergy(const AccelData &accel, const GyroData &gyro, float gyroWeight);
+
+/**
+ * @class :AdaptiveRateController
+ * @brief :Selects the ODR tier from the live motion energy.
+ *
+ * The metric is | |a|² - 1 | + gyroWeight * |ω|² (a in g, ω in dps): zero at
+ * rest in any orientation, cheap to evaluate per sample. Call update() for
+ * every sample read and pace acquisition with samplePeriod_us().
+ *
+ * The tier table is checked once in the constructor. With gyro DLPF_CFG 0 or
+ * 7 the MPU9250 samples at 8 kHz and ignores SMPLRT_DIV, faster than the bus
+ * can be polled, so such tiers are rejected, along with tables whose rate
+ * falls or whose enterEnergy does not rise from tier to tier. A rejected table makes
+ * begin() fail and update() a no-op; see configValid().
+ */
+class AdaptiveRateController
+{
+public:
+    /**
+     * @brief :Constructor for AdaptiveRateController.
+     *
+     * @param hal    :HAL used to apply rate changes.
+     * @param config :Tier table and hysteresis settings.
+     */
+    AdaptiveRateController(MPU9250_HAL &hal, const AdaptiveRateConfig &config);
+
+    /**
+     * @brief :Apply the slowest tier and start the statistics.
+     *
+     * @param now_us :Current time in microseconds.
+     * @return :true if the rate was applied, false on bus error or a rejected tier table.
+     */
+    bool begin(uint32_t now_us);
+
+    /**
+     * @brief :false if the constructor rejected the tier table.
+     */
+    bool configValid() const { return valid_; }
+
+    /**
+     * @brief :Feed one sample and switch tiers if needed.
+     *
+     * @param accel  :Accelerometer sample in g.
+     * @param gyro   :Gyroscope sample in dps.
+     * @param now_us :Acquisition time in microseconds.
+     * @return :true if the tier changed on this sample.
+     */
+    bool update(const AccelData &accel, const GyroData &gyro, uint32_t now_us);
+
+    /**
+     * @brief :Index of the active tier.
+     */
+    uint8_t tier() const { return tier_; }
+
+    /**
+     * @brief :Sample period of the active tier in microseconds.
+     */
+    uint32_t samplePeriod_us() const;
+
+    /**
+     * @brief :Motion energy of the last sample.
+     */
+    float motionEnergy() const { return energy_; }
+
+    /**
+     * @brief :Total time spent in a tier, in microseconds.
+     */
+    uint64_t timeInTier_us(uint8_t tier) const;
+
+    /**
+     * @brief :Bus transactions avoided compared to running the fastest tier.
+     *
+     * Counts one transaction per sample read and one per rate change that
+     * setSampleRate() actually wrote; switching to a tier with the same
+     * register settings costs nothing.
+     */
+    uint32_t transactionsSaved() const;
+
+    /**
+     * @brief :Number of tier switches so far.
+     */
+    uint32_t switches() const { return switches_; }
+
+private:
+    MPU9250_HAL &hal_;
+    AdaptiveRateConfig config_;
+    bool     valid_;
+
+    uint8_t  tier_;
+    uint16_t quietCount_;
+    float    energy_;
+    uint32_t lastUpdate_us_;
+    uint64_t timeInTier_us_[ADAPTIVE_MAX_TIERS];
+    uint64_t totalTime_us_;
+    uint32_t transactions_;   // reads + rate writes actually issued
+    uint32_t switches_;
+
+    bool applyTier(uint8_t tier);
+};
+
+#endif // IMU_ADAPTIVE_RATE_HPP
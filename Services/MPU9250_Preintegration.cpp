@@ -0,0 +1,120 @@
+#include "MPU9250_Preintegration.hpp"
+
+namespace
+{
+    constexpr float DEG_TO_RAD = 3.14159265358979f / 180.0f;
+    constexpr float G_TO_MPS2  = 9.80665f;
+
+    /* out += k * (a × b) */
+    inline void addCross(float out[3], const float a[3], const float b[3], float k)
+    {
+        out[0] += k * (a[1] * b[2] - a[2] * b[1]);
+        out[1] += k * (a[2] * b[0] - a[0] * b[2]);
+        out[2] += k * (a[0] * b[1] - a[1] * b[0]);
+    }
+}
+
+Preintegrator::Preintegrator(const PreintConfig &config)
+: config_(config),
+  out_()
+{
+    if (config_.decimation == 0)
+    {
+        config_.decimation = 1;
+    }
+    reset();
+}
+
+void Preintegrator::reset()
+{
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        alpha_[i]       = 0.0f;
+        upsilon_[i]     = 0.0f;
+        coning_[i]      = 0.0f;
+        sculling_[i]    = 0.0f;
+        prevAlpha_[i]   = 0.0f;
+        prevUpsilon_[i] = 0.0f;
+    }
+    dt_s_  = 0.0f;
+    count_ = 0;
+}
+
+bool Preintegrator::push(const GyroData &gyro, const AccelData &accel, float dt_s)
+{
+    const float a[3] =
+    {
+        gyro.x_dps * DEG_TO_RAD * dt_s,
+        gyro.y_dps * DEG_TO_RAD * dt_s,
+        gyro.z_dps * DEG_TO_RAD * dt_s
+    };
+    const float v[3] =
+    {
+        accel.x_g * G_TO_MPS2 * dt_s,
+        accel.y_g * G_TO_MPS2 * dt_s,
+        accel.z_g * G_TO_MPS2 * dt_s
+    };
+
+    /*
+     * Savage two-sample corrections, using the sums *before* this sample:
+     *   coning   += ½ (α + α_prev/6) × a
+     *   sculling += ½ [(α + α_prev/6) × v + (υ + υ_prev/6) × a]
+     * The previous-sample terms carry over between intervals.
+     */
+    float aHat[3];
+    float vHat[3];
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        aHat[i] = alpha_[i]   + prevAlpha_[i]   * (1.0f / 6.0f);
+        vHat[i] = upsilon_[i] + prevUpsilon_[i] * (1.0f / 6.0f);
+    }
+
+    addCross(coning_,   aHat, a, 0.5f);
+    addCross(sculling_, aHat, v, 0.5f);
+    addCross(sculling_, vHat, a, 0.5f);
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        alpha_[i]      += a[i];
+        upsilon_[i]    += v[i];
+        prevAlpha_[i]   = a[i];
+        prevUpsilon_[i] = v[i];
+    }
+    dt_s_ += dt_s;
+    count_++;
+
+    if (count_ < config_.decimation)
+    {
+        return false;
+    }
+
+    /* Δθ = α + coning;  Δv = υ + ½ α × υ (rotation compensation) + sculling */
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        out_.dTheta_rad[i] = alpha_[i] + coning_[i];
+        out_.dVel_mps[i]   = upsilon_[i] + sculling_[i];
+    }
+    addCross(out_.dVel_mps, alpha_, upsilon_, 0.5f);
+
+    /* White-noise random walk: variance grows linearly with the interval */
+    const float varTheta = config_.gyroNoiseDensity  * config_.gyroNoiseDensity  * dt_s_;
+    const float varVel   = config_.accelNoiseDensity * config_.accelNoiseDensity * dt_s_;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        out_.varTheta[i] = varTheta;
+        out_.varVel[i]   = varVel;
+    }
+    out_.dt_s    = dt_s_;
+    out_.samples = count_;
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        alpha_[i]    = 0.0f;
+        upsilon_[i]  = 0.0f;
+        coning_[i]   = 0.0f;
+        sculling_[i] = 0.0f;
+    }
+    dt_s_  = 0.0f;
+    count_ = 0;
+    return true;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file  :MPU9250_Preintegration.hpp
+ * @brief :High-rate IMU preintegration with coning/sculling compensation.
+ *
+ * The Preintegrator runs at the full sensor ODR and accumulates the gyro and
+ * accelerometer samples into delta-angle and delta-velocity increments over
+ * a configurable number of samples. Coning (delta-angle) and sculling
+ * (delta-velocity) corrections use Savage's two-sample form, so the
+ * high-rate rotation is not lost when navigation consumes the increments at
+ * the lower output rate. Each increment carries its diagonal covariance,
+ * propagated from the configured sensor noise densities.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef IMU_PREINTEGRATION_HPP
+#define IMU_PREINTEGRATION_HPP
+
+/****************************************** include part ********************************************* */
+#include "MPU9250_Service.hpp"
+#include <cstdint>
+/**************************************** User Data Types Part *************************************** */
+/**
+ * @struct :PreintConfig
+ * @brief  :Output rate and noise model of the Preintegrator.
+ */
+struct PreintConfig
+{
+    uint16_t decimation;           // input samples per emitted increment (>= 1)
+    float    gyroNoiseDensity;     // rad/s/√Hz (angle random walk)
+    float    accelNoiseDensity;    // m/s²/√Hz (velocity random walk)
+};
+
+/**
+ * @struct :DeltaIncrement
+ * @brief  :Preintegrated motion over one output interval, body frame.
+ */
+struct DeltaIncrement
+{
+    float    dTheta_rad[3];  // rotation vector, coning corrected
+    float    dVel_mps[3];    // specific-force velocity change, sculling corrected
+    float    varTheta[3];    // per-axis variance of dTheta (rad²)
+    float    varVel[3];      // per-axis variance of dVel ((m/s)²)
+    float    dt_s;           // integration interval
+    uint16_t samples;        // input samples folded into this increment
+};
+/****************************************************************************************************** */
+/**
+ * @class :Preintegrator
+ * @brief :Accumulates full-rate samples into low-rate delta increments.
+ *
+ * Feed every sample with push(); it returns true each time `decimation`
+ * samples have been folded in and a new increment is available from
+ * output().
+ */
+class Preintegrator
+{
+public:
+    /**
+     * @brief :Constructor for Preintegrator.
+     *
+     * @param config :Decimation and noise densities.
+     */
+    explicit Preintegrator(const PreintConfig &config);
+
+    /**
+     * @brief :Fold one sample into the running increment.
+     *
+     * @param gyro  :Angular rate in dps, as returned by IMUService.
+     * @param accel :Specific force in g, as returned by IMUService.
+     * @param dt_s  :Time since the previous sample in seconds.
+     * @return :true if this sample completed an increment.
+     */
+    bool push(const GyroData &gyro, const AccelData &accel, float dt_s);
+
+    /**
+     * @brief :Most recently completed increment.
+     */
+    const DeltaIncrement &output() const { return out_; }
+
+    /**
+     * @brief :Drop the running increment (e.g., after a data gap).
+     */
+    void reset();
+
+private:
+    PreintConfig   config_;
+    DeltaIncrement out_;
+
+    /* Running sums over the current interval */
+    float    alpha_[3];      // Σ gyro increments
+    float    upsilon_[3];    // Σ accel increments
+    float    coning_[3];
+    float    sculling_[3];
+    float    prevAlpha_[3];  // last sample's gyro increment
+    float    prevUpsilon_[3];
+    float    dt_s_;
+    uint16_t count_;
+};
+
+#endif // IMU_PREINTEGRATION_HPP
@@ -0,0 +1,140 @@
+#include "MPU9250_Publisher.hpp"
+#include <cstring>
+
+namespace
+{
+    /* Attempts before a reader gives up on a slot that keeps changing */
+    constexpr uint8_t READ_RETRIES = 4;
+
+    static_assert((PUBLISHER_SLOTS & (PUBLISHER_SLOTS - 1)) == 0, "PUBLISHER_SLOTS must be a power of two");
+    static_assert(PUBLISHER_SLOTS >= 2, "readers need at least one stable slot");
+}
+
+/* ************************************** SamplePublisher **************************************** */
+
+SamplePublisher::SamplePublisher()
+: published_(0)
+{
+    for (uint32_t s = 0; s < PUBLISHER_SLOTS; s++)
+    {
+        slots_[s].seq.store(0, std::memory_order_relaxed);
+        for (uint32_t w = 0; w < WORDS; w++)
+        {
+            slots_[s].words[w].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void SamplePublisher::publish(const IMUData &data, uint32_t timestamp_us)
+{
+    const uint32_t number = published_.load(std::memory_order_relaxed) + 1;
+
+    PublishedSample sample;
+    sample.data         = data;
+    sample.timestamp_us = timestamp_us;
+    sample.number       = number;
+
+    uint32_t words[WORDS];
+    std::memcpy(words, &sample, sizeof(words));
+
+    Slot &slot = slots_[number & (PUBLISHER_SLOTS - 1)];
+    const uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+
+    /* Odd sequence marks the slot as being written; the fence keeps the payload after it */
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (uint32_t w = 0; w < WORDS; w++)
+    {
+        slot.words[w].store(words[w], std::memory_order_relaxed);
+    }
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+    published_.store(number, std::memory_order_release);
+}
+
+bool SamplePublisher::readSample(uint32_t number, PublishedSample &out) const
+{
+    const Slot &slot = slots_[number & (PUBLISHER_SLOTS - 1)];
+    uint32_t words[WORDS];
+
+    for (uint8_t attempt = 0; attempt < READ_RETRIES; attempt++)
+    {
+        const uint32_t before = slot.seq.load(std::memory_order_acquire);
+        if ((before & 1u) != 0)
+        {
+            continue; // writer in progress
+        }
+
+        for (uint32_t w = 0; w < WORDS; w++)
+        {
+            words[w] = slot.words[w].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != before)
+        {
+            continue; // torn read
+        }
+
+        std::memcpy(&out, words, sizeof(words));
+        return (out.number == number);
+    }
+
+    return false;
+}
+
+bool SamplePublisher::readLatest(PublishedSample &out) const
+{
+    const uint32_t latest = latestNumber();
+    if (latest == 0)
+    {
+        return false;
+    }
+
+    /* If the newest slot is being rewritten (e.g. ISR preempted the writer), fall back */
+    for (uint32_t back = 0; back < (PUBLISHER_SLOTS - 1); back++)
+    {
+        if (readSample(latest - back, out))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ************************************** SampleReader **************************************** */
+
+SampleReader::SampleReader(const SamplePublisher &publisher)
+: publisher_(publisher),
+  nextNumber_(publisher.latestNumber() + 1),
+  missed_(0)
+{ }
+
+bool SampleReader::next(PublishedSample &out)
+{
+    const uint32_t latest = publisher_.latestNumber();
+
+    while ((int32_t)(latest - nextNumber_) >= 0)
+    {
+        /* The slot after `latest` may be in the middle of being overwritten */
+        const uint32_t oldest = latest - (PUBLISHER_SLOTS - 2);
+        if ((int32_t)(oldest - nextNumber_) > 0)
+        {
+            missed_     += oldest - nextNumber_;
+            nextNumber_  = oldest;
+        }
+
+        if (publisher_.readSample(nextNumber_, out))
+        {
+            nextNumber_++;
+            return true;
+        }
+
+        /* Overwritten while we were reading it */
+        missed_++;
+        nextNumber_++;
+    }
+
+    return false;
+}
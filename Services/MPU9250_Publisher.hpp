@@ -0,0 +1,143 @@
+/**
+ * @file  :MPU9250_Publisher.hpp
+ * @brief :Lock-free single-writer, multi-reader publication of IMU samples.
+ *
+ * Fusion, telemetry, logging and control all want the latest IMU data, but
+ * each calling IMUService::getAll() would trigger its own bus read. The
+ * SamplePublisher lets the acquisition loop write every frame once into a
+ * small history ring of seqlock-protected slots. Any number of readers, on
+ * either core or in an ISR, take consistent snapshots without locks, heap
+ * copies or bus traffic, and SampleReader cursors report how many samples
+ * they missed.
+ *
+ * Payload words are std::atomic and accessed relaxed, bracketed by the slot
+ * sequence counter and fences, so concurrent reads are race-free under the
+ * C++ memory model (and compile to plain loads/stores plus DMB on the M0+).
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef IMU_PUBLISHER_HPP
+#define IMU_PUBLISHER_HPP
+
+/****************************************** include part ********************************************* */
+#include "MPU9250_Service.hpp"
+#include <atomic>
+#include <cstdint>
+/**************************************** User Data Types Part *************************************** */
+
+/* Slots in the history ring (power of two) */
+constexpr uint32_t PUBLISHER_SLOTS = 8;
+
+/**
+ * @struct :PublishedSample
+ * @brief  :One acquired frame as seen by readers.
+ */
+struct PublishedSample
+{
+    IMUData  data;
+    uint32_t timestamp_us;  // acquisition time
+    uint32_t number;        // 1-based publication counter
+};
+/****************************************************************************************************** */
+/**
+ * @class :SamplePublisher
+ * @brief :Seqlock-protected history ring written by a single producer.
+ *
+ * publish() must only be called from one context. Readers never block the
+ * writer; a read that races with a write is retried a bounded number of
+ * times, so an ISR that preempts the writer mid-update still returns (with
+ * the previous, stable sample).
+ */
+class SamplePublisher
+{
+public:
+    SamplePublisher();
+
+    /**
+     * @brief :Publish one frame (single writer only).
+     *
+     * @param data         :Processed sample.
+     * @param timestamp_us :Acquisition time in microseconds.
+     */
+    void publish(const IMUData &data, uint32_t timestamp_us);
+
+    /**
+     * @brief :Number of the most recently published sample (0 if none).
+     */
+    uint32_t latestNumber() const { return published_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief :Snapshot of the newest sample that can be read consistently.
+     *
+     * @param out :Destination.
+     * @return :true if a sample was copied, false if nothing was published yet.
+     */
+    bool readLatest(PublishedSample &out) const;
+
+    /**
+     * @brief :Snapshot of a specific sample from the history ring.
+     *
+     * @param number :Publication number (see PublishedSample::number).
+     * @param out    :Destination.
+     * @return :true if copied, false if not yet published, already
+     *         overwritten, or continuously being rewritten.
+     */
+    bool readSample(uint32_t number, PublishedSample &out) const;
+
+private:
+    /* PublishedSample as 32-bit words for the relaxed atomic copy */
+    static constexpr uint32_t WORDS = sizeof(PublishedSample) / sizeof(uint32_t);
+    static_assert(sizeof(PublishedSample) % sizeof(uint32_t) == 0, "sample must be word sized");
+
+    struct Slot
+    {
+        std::atomic<uint32_t> seq;  // odd while being written
+        std::atomic<uint32_t> words[WORDS];
+    };
+
+    Slot slots_[PUBLISHER_SLOTS];
+    std::atomic<uint32_t> published_;
+};
+
+/**
+ * @class :SampleReader
+ * @brief :Per-consumer cursor that walks the published samples in order.
+ *
+ * Each consumer owns one reader. next() returns samples oldest first; if the
+ * consumer falls behind by more than the history depth, it skips ahead and
+ * the skipped samples are added to missed().
+ */
+class SampleReader
+{
+public:
+    /**
+     * @brief :Constructor for SampleReader.
+     *
+     * @param publisher :Publisher to follow; starts after its latest sample.
+     */
+    explicit SampleReader(const SamplePublisher &publisher);
+
+    /**
+     * @brief :Take the next unread sample.
+     *
+     * @param out :Destination.
+     * @return :true if a sample was copied, false if none is pending.
+     */
+    bool next(PublishedSample &out);
+
+    /**
+     * @brief :Samples published but never returned to this reader.
+     */
+    uint32_t missed() const { return missed_; }
+
+private:
+    const SamplePublisher &publisher_;
+    uint32_t nextNumber_;
+    uint32_t missed_;
+};
+
+#endif // IMU_PUBLISHER_HPP
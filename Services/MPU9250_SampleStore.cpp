@@ -0,0 +1,249 @@
+#include "MPU9250_SampleStore.hpp"
+#include <cstring>
+
+namespace
+{
+    constexpr uint32_t INDEX_MASK  = STORE_CAPACITY - 1;
+    constexpr uint32_t RESYNC_MASK = STORE_RESYNC_SLOTS - 1;
+
+    static_assert((STORE_CAPACITY & (STORE_CAPACITY - 1)) == 0, "STORE_CAPACITY must be a power of two");
+    static_assert((STORE_RESYNC_SLOTS & (STORE_RESYNC_SLOTS - 1)) == 0, "STORE_RESYNC_SLOTS must be a power of two");
+}
+
+SampleStore::SampleStore()
+: head_(0),
+  tail_(0),
+  headTime_us_(0),
+  tailTime_us_(0),
+  dropped_(0),
+  resyncHead_(0),
+  resyncTail_(0)
+{ }
+
+bool SampleStore::stamp(uint32_t timestamp_us, uint16_t &delta)
+{
+    if (head_ == tail_)
+    {
+        /* First sample after empty: it becomes the time base */
+        headTime_us_ = timestamp_us;
+        tailTime_us_ = timestamp_us;
+        delta = 0;
+        return true;
+    }
+
+    /* Round to the nearest tick and rebuild from the rounded value, so errors do not accumulate */
+    const uint32_t ticks = (timestamp_us - headTime_us_ + (STORE_TICK_US / 2)) / STORE_TICK_US;
+    if (ticks < STORE_RESYNC)
+    {
+        headTime_us_ += ticks * STORE_TICK_US;
+        delta = (uint16_t)ticks;
+        return true;
+    }
+
+    /* Long gap or time going backwards (wraps to a huge delta): keep the exact time aside */
+    if ((resyncHead_ - resyncTail_) >= STORE_RESYNC_SLOTS)
+    {
+        return false;
+    }
+    resync_us_[resyncHead_ & RESYNC_MASK] = timestamp_us;
+    resyncHead_++;
+    headTime_us_ = timestamp_us;
+    delta = STORE_RESYNC;
+    return true;
+}
+
+bool SampleStore::push(const int16_t channel[FRAME_CHANNEL_COUNT], uint32_t timestamp_us)
+{
+    const uint32_t idx = head_ & INDEX_MASK;
+    if ((size() >= STORE_CAPACITY) || !stamp(timestamp_us, delta_[idx]))
+    {
+        dropped_++;
+        return false;
+    }
+
+    for (uint8_t c = 0; c < FRAME_CHANNEL_COUNT; c++)
+    {
+        columns_[c][idx] = channel[c];
+    }
+    head_++;
+    return true;
+}
+
+bool SampleStore::capture(MPU9250_HAL &hal, uint32_t now_us)
+{
+    int16_t ch[FRAME_CHANNEL_COUNT] = {};
+    if (!hal.readAllRaw(ch[FRAME_ACCEL_X], ch[FRAME_ACCEL_Y], ch[FRAME_ACCEL_Z],
+                        ch[FRAME_GYRO_X],  ch[FRAME_GYRO_Y],  ch[FRAME_GYRO_Z],
+                        ch[FRAME_TEMP]))
+    {
+        return false;
+    }
+    return push(ch, now_us);
+}
+
+size_t SampleStore::pushFrames(const uint8_t *bytes, size_t frames, bool nineAxis,
+                               uint32_t firstTimestamp_us, uint32_t period_us)
+{
+    const size_t space = STORE_CAPACITY - size();
+    size_t stored = (frames < space) ? frames : space;
+
+    /* Timestamps first: a frame that needs a resync slot when none is free ends the burst */
+    const uint32_t first = head_;
+    for (size_t i = 0; i < stored; i++)
+    {
+        if (!stamp(firstTimestamp_us + (uint32_t)i * period_us, delta_[head_ & INDEX_MASK]))
+        {
+            stored = i;
+            break;
+        }
+        head_++;
+    }
+    dropped_ += (uint32_t)(frames - stored);
+
+    const size_t frameBytes = nineAxis ? MPU9250_FRAME9_BYTES : MPU9250_FRAME_BYTES;
+
+    /* At most two runs: up to the end of the ring, then from the start */
+    size_t done = 0;
+    while (done < stored)
+    {
+        const uint32_t idx = (first + done) & INDEX_MASK;
+        size_t run = STORE_CAPACITY - idx;
+        if (run > (stored - done))
+        {
+            run = stored - done;
+        }
+
+        FrameColumns cols;
+        for (uint8_t c = 0; c < FRAME_CHANNEL_COUNT; c++)
+        {
+            cols.channel[c] = columns_[c] + idx;
+        }
+
+        if (nineAxis)
+        {
+            decodeFrames9(bytes + done * frameBytes, run, cols);
+        }
+        else
+        {
+            decodeFrames(bytes + done * frameBytes, run, cols);
+            for (uint8_t c = FRAME_MAG_X; c <= FRAME_MAG_Z; c++)
+            {
+                std::memset(cols.channel[c], 0, run * sizeof(int16_t));
+            }
+        }
+        done += run;
+    }
+    return stored;
+}
+
+bool SampleStore::pop(RawFrame &frame, uint32_t &timestamp_us)
+{
+    if (head_ == tail_)
+    {
+        return false;
+    }
+
+    const uint32_t idx = tail_ & INDEX_MASK;
+    for (uint8_t c = 0; c < FRAME_CHANNEL_COUNT; c++)
+    {
+        frame.channel[c] = columns_[c][idx];
+    }
+    frame.delta  = delta_[idx];
+    timestamp_us = tailTime_us_;
+
+    advanceTail(1);
+    return true;
+}
+
+size_t SampleStore::readBatch(IMUData *out, uint32_t *timestamps_us, size_t maxSamples, const SampleScale &scale)
+{
+    const size_t count = (size() < maxSamples) ? size() : maxSamples;
+
+    size_t done = 0;
+    while (done < count)
+    {
+        const uint32_t idx = (tail_ + done) & INDEX_MASK;
+        size_t run = STORE_CAPACITY - idx;
+        if (run > (count - done))
+        {
+            run = count - done;
+        }
+
+        /* Ten sequential int16 streams in, one contiguous IMUData out per sample */
+        const int16_t *ax = columns_[FRAME_ACCEL_X] + idx;
+        const int16_t *ay = columns_[FRAME_ACCEL_Y] + idx;
+        const int16_t *az = columns_[FRAME_ACCEL_Z] + idx;
+        const int16_t *tc = columns_[FRAME_TEMP]    + idx;
+        const int16_t *gx = columns_[FRAME_GYRO_X]  + idx;
+        const int16_t *gy = columns_[FRAME_GYRO_Y]  + idx;
+        const int16_t *gz = columns_[FRAME_GYRO_Z]  + idx;
+        const int16_t *mx = columns_[FRAME_MAG_X]   + idx;
+        const int16_t *my = columns_[FRAME_MAG_Y]   + idx;
+        const int16_t *mz = columns_[FRAME_MAG_Z]   + idx;
+        IMUData *dst = out + done;
+        for (size_t i = 0; i < run; i++)
+        {
+            dst[i].accel.x_g           = ax[i] * scale.accel;
+            dst[i].accel.y_g           = ay[i] * scale.accel;
+            dst[i].accel.z_g           = az[i] * scale.accel;
+            dst[i].gyro.x_dps          = gx[i] * scale.gyro;
+            dst[i].gyro.y_dps          = gy[i] * scale.gyro;
+            dst[i].gyro.z_dps          = gz[i] * scale.gyro;
+            dst[i].temp.temperature_c  = (tc[i] * scale.temp) + scale.tempOffset;
+            dst[i].mag.x_uT            = mx[i] * scale.mag;
+            dst[i].mag.y_uT            = my[i] * scale.mag;
+            dst[i].mag.z_uT            = mz[i] * scale.mag;
+        }
+        done += run;
+    }
+
+    if (timestamps_us != nullptr)
+    {
+        uint32_t t      = tailTime_us_;
+        uint32_t resync = resyncTail_;
+        for (size_t i = 0; i < count; i++)
+        {
+            if (i != 0)
+            {
+                const uint16_t d = delta_[(tail_ + i) & INDEX_MASK];
+                t = (d == STORE_RESYNC) ? resync_us_[resync++ & RESYNC_MASK] : (t + d * STORE_TICK_US);
+            }
+            timestamps_us[i] = t;
+        }
+    }
+
+    advanceTail(count);
+    return count;
+}
+
+size_t SampleStore::contiguous() const
+{
+    const size_t toEnd = STORE_CAPACITY - (tail_ & INDEX_MASK);
+    return (size() < toEnd) ? size() : toEnd;
+}
+
+void SampleStore::discard(size_t count)
+{
+    advanceTail((count < size()) ? count : size());
+}
+
+void SampleStore::advanceTail(size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        tail_++;
+        if (tail_ != head_)
+        {
+            const uint16_t d = delta_[tail_ & INDEX_MASK];
+            if (d == STORE_RESYNC)
+            {
+                tailTime_us_ = resync_us_[resyncTail_ & RESYNC_MASK];
+                resyncTail_++;
+            }
+            else
+            {
+                tailTime_us_ += d * STORE_TICK_US;
+            }
+        }
+    }
+}
@@ -0,0 +1,174 @@
+/**
+ * @file  :MPU9250_SampleStore.hpp
+ * @brief :Compact raw-frame buffering for the MPU9250 with deferred conversion.
+ *
+ * IMUData keeps every sample as ten floats (40 bytes), so buffering processed
+ * samples in the RP2040's SRAM wastes most of it on a representation that
+ * carries no more information than the 16-bit registers it came from. The
+ * SampleStore keeps samples in their raw form instead: one int16 column per
+ * channel plus a 16-bit timestamp delta, 22 bytes per sample. Conversion to
+ * physical units is deferred to readBatch(), which streams the columns
+ * sequentially and fills a batch of IMUData in one pass.
+ *
+ * Every column is a contiguous, word-aligned int16 array, so a consumer can
+ * hand column(c) / contiguous() straight to DMA or a block write without
+ * gathering.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef IMU_SAMPLE_STORE_HPP
+#define IMU_SAMPLE_STORE_HPP
+
+/****************************************** include part ********************************************* */
+#include "../HAL/MPU9250_HAL.hpp"
+#include "../HAL/MPU9250_Decode.hpp"
+#include "MPU9250_Service.hpp"
+#include <cstddef>
+#include <cstdint>
+/**************************************** User Data Types Part *************************************** */
+
+/* Samples held by a SampleStore (power of two) */
+constexpr uint32_t STORE_CAPACITY = 1024;
+
+/* Resolution of the stored timestamp delta; 16 bits cover up to ~262 ms between samples */
+constexpr uint32_t STORE_TICK_US  = 4;
+
+/* Delta value marking a sample whose absolute time is kept in a resync slot */
+constexpr uint16_t STORE_RESYNC   = 0xFFFF;
+
+/* Resync slots per SampleStore (power of two): gaps > ~262 ms held at once */
+constexpr uint32_t STORE_RESYNC_SLOTS = 16;
+
+/**
+ * @struct :RawFrame
+ * @brief  :One packed raw sample: register values plus time since the previous sample.
+ */
+struct RawFrame
+{
+    int16_t  channel[FRAME_CHANNEL_COUNT];  // indexed by FrameChannel
+    uint16_t delta;                         // STORE_TICK_US units since the previous sample, or STORE_RESYNC
+};
+
+static_assert(sizeof(RawFrame) == 22, "RawFrame must stay packed");
+/****************************************************************************************************** */
+/**
+ * @class :SampleStore
+ * @brief :Columnar ring of raw samples.
+ *
+ * Single producer, single consumer, same context. When the ring is full new
+ * samples are rejected and counted in dropped(), so a slow consumer never
+ * loses history it has not read yet. Absolute timestamps are rebuilt from the
+ * deltas on read. A gap longer than the delta range, or a timestamp that
+ * goes backwards, is stored as STORE_RESYNC with the absolute time in a small
+ * side ring, so no sample is misdated; if all STORE_RESYNC_SLOTS are in use
+ * the sample is rejected and counted in dropped().
+ */
+class SampleStore
+{
+public:
+    SampleStore();
+
+    /**
+     * @brief :Store one sample.
+     *
+     * @param channel      :Raw values indexed by FrameChannel.
+     * @param timestamp_us :Acquisition time in microseconds.
+     * @return :true if stored, false if the store (or, for a long gap, the resync ring) is full.
+     */
+    bool push(const int16_t channel[FRAME_CHANNEL_COUNT], uint32_t timestamp_us);
+
+    /**
+     * @brief :Read accel, temperature and gyro from the HAL and store them unconverted.
+     *
+     * The MAG columns are stored as zero, like IMUService::getAll().
+     *
+     * @param hal    :HAL to read from.
+     * @param now_us :Acquisition time in microseconds.
+     * @return :true if read and stored.
+     */
+    bool capture(MPU9250_HAL &hal, uint32_t now_us);
+
+    /**
+     * @brief :Decode a burst of raw register frames straight into the columns.
+     *
+     * @param bytes              :Frames packed back to back (see MPU9250_Decode.hpp).
+     * @param frames             :Number of frames.
+     * @param nineAxis           :true for 20-byte frames with MAG, false for 14-byte frames.
+     * @param firstTimestamp_us  :Acquisition time of the first frame.
+     * @param period_us          :Time between frames.
+     * @return :Number of frames stored; the rest are counted as dropped.
+     */
+    size_t pushFrames(const uint8_t *bytes, size_t frames, bool nineAxis,
+                      uint32_t firstTimestamp_us, uint32_t period_us);
+
+    /**
+     * @brief :Remove the oldest sample in packed form.
+     *
+     * @param frame        :Destination.
+     * @param timestamp_us :Rebuilt acquisition time.
+     * @return :true if a sample was removed, false if empty.
+     */
+    bool pop(RawFrame &frame, uint32_t &timestamp_us);
+
+    /**
+     * @brief :Remove up to maxSamples of the oldest samples, converted to physical units.
+     *
+     * @param out           :Destination, maxSamples entries.
+     * @param timestamps_us :Rebuilt acquisition times, maxSamples entries, or nullptr.
+     * @param maxSamples    :Capacity of the destination arrays.
+     * @param scale         :Conversion factors (see IMUService::sampleScale()).
+     * @return :Number of samples converted.
+     */
+    size_t readBatch(IMUData *out, uint32_t *timestamps_us, size_t maxSamples, const SampleScale &scale);
+
+    /**
+     * @brief :Oldest entries of one channel, for zero-copy column access.
+     *
+     * Valid for contiguous() entries, until the next pop/readBatch/discard.
+     */
+    const int16_t *column(FrameChannel c) const { return columns_[c] + (tail_ & (STORE_CAPACITY - 1)); }
+
+    /**
+     * @brief :Number of stored samples before the ring wraps, starting at the oldest.
+     */
+    size_t contiguous() const;
+
+    /**
+     * @brief :Drop the oldest samples, e.g. after a consumer used column().
+     *
+     * @param count :Samples to drop (clamped to size()).
+     */
+    void discard(size_t count);
+
+    /**
+     * @brief :Number of stored samples.
+     */
+    size_t size() const { return head_ - tail_; }
+
+    /**
+     * @brief :Samples rejected because the store was full.
+     */
+    uint32_t dropped() const { return dropped_; }
+
+private:
+    alignas(4) int16_t  columns_[FRAME_CHANNEL_COUNT][STORE_CAPACITY];
+    alignas(4) uint16_t delta_[STORE_CAPACITY];
+    uint32_t resync_us_[STORE_RESYNC_SLOTS];  // absolute times of STORE_RESYNC samples, oldest first
+
+    uint32_t head_;
+    uint32_t tail_;
+    uint32_t headTime_us_;   // rebuilt time of the newest sample
+    uint32_t tailTime_us_;   // rebuilt time of the oldest sample
+    uint32_t dropped_;
+    uint32_t resyncHead_;
+    uint32_t resyncTail_;
+
+    bool     stamp(uint32_t timestamp_us, uint16_t &delta);
+    void     advanceTail(size_t count);
+};
+
+#endif // IMU_SAMPLE_STORE_HPP
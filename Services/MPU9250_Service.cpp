@@ -1,4 +1,5 @@
 #include "MPU9250_Service.hpp"
+#include "MPU9250_Publisher.hpp"
 #include "../HAL/MPU9250_HAL.hpp"
 #include <cmath>
 #include "pico/stdlib.h"
@@ -9,7 +10,10 @@ IMUService::IMUService(MPU9250_HAL &hal) // better to but in magic file
   accelScale_(1.0f / 16384.0f),   
   gyroScale_(1.0f / 131.0f),      
   tempScale_(1.0f / 333.87f),     
-  magScale_(0.15f)                
+  magScale_(0.15f),
+  tempComp_(nullptr),
+  publisher_(nullptr),
+  firstSample_us_(0)
 {}
 
 bool IMUService::begin() 
@@ -19,6 +23,7 @@ bool IMUService::begin()
         return false;
     }
 
+    /* Idempotent: skips the reset when the HAL is already configured */
     if (!hal_.initMPU9250())
     {
         return false;
@@ -45,6 +50,12 @@ AccelData IMUService::getAccelerometer()
         return {0, 0, 0};
     }
 
+    if (tempComp_ != nullptr)
+    {
+        tempComp_->correctAccel(ax, ay, az);
+    }
+    markSample();
+
     return 
     {
         ax * accelScale_,
@@ -61,6 +72,12 @@ GyroData IMUService::getGyroscope()
         return {0, 0, 0};
     }
 
+    if (tempComp_ != nullptr)
+    {
+        tempComp_->correctGyro(gx, gy, gz);
+    }
+    markSample();
+
     return 
     {
         gx * gyroScale_,
@@ -78,6 +95,10 @@ TempData IMUService::getTemperature()
     }
 
     float temp_c = (tempRaw * tempScale_) + 21.0f;
+    if (tempComp_ != nullptr)
+    {
+        tempComp_->update(temp_c);
+    }
     {
         return { temp_c };
     }
@@ -104,12 +125,28 @@ IMUData IMUService::getAll()
     int16_t tempRaw;
     //int16_t mx, my, mz;
 
-    hal_.readAllRaw(ax,ay,az,
-                    gx,gy,gz,
-                    tempRaw);
-
     IMUData data;
 
+    if (!hal_.readAllRaw(ax,ay,az,
+                         gx,gy,gz,
+                         tempRaw))
+    {
+        return {};
+    }
+    markSample();
+
+    data.temp = 
+    {
+        (tempRaw / 333.87f) + 21.0f
+    };
+
+    if (tempComp_ != nullptr)
+    {
+        tempComp_->update(data.temp.temperature_c);
+        tempComp_->correctAccel(ax, ay, az);
+        tempComp_->correctGyro(gx, gy, gz);
+    }
+
     data.accel= 
     {
         ax * accelScale_,
@@ -124,11 +161,6 @@ IMUData IMUService::getAll()
         gz * gyroScale_
     };
 
-    data.temp = 
-    {
-        (tempRaw / 333.87f) + 21.0f
-    };
-
     /*data.mag = 
     {
         mx * magScale_,
@@ -136,5 +168,33 @@ IMUData IMUService::getAll()
         mz * magScale_
     };*/
 
+    if (publisher_ != nullptr)
+    {
+        publisher_->publish(data, time_us_32());
+    }
+
     return data;
 }
+
+void IMUService::setTempCompensator(TempCompensator *comp)
+{
+    tempComp_ = comp;
+}
+
+void IMUService::setPublisher(SamplePublisher *publisher)
+{
+    publisher_ = publisher;
+}
+
+SampleScale IMUService::sampleScale() const
+{
+    return { accelScale_, gyroScale_, tempScale_, 21.0f, magScale_ };
+}
+
+void IMUService::markSample()
+{
+    if (firstSample_us_ == 0)
+    {
+        firstSample_us_ = time_us_32();
+    }
+}
@@ -18,7 +18,10 @@
 
 /****************************************** include part ********************************************* */
 #include "../HAL/MPU9250_HAL.hpp"
+#include "MPU9250_TempComp.hpp"
 #include <cstdint>
+
+class SamplePublisher;
 /**************************************** User Data Types Part *************************************** */
 /**
  * @struct :AccelData
@@ -73,6 +76,19 @@ struct IMUData
     TempData temp;
     MagData mag;
 };
+
+/**
+ * @struct :SampleScale
+ * @brief  :Raw LSB to physical unit factors, for converting stored raw samples later.
+ */
+struct SampleScale
+{
+    float accel;       // LSB -> g
+    float gyro;        // LSB -> deg/s
+    float temp;        // LSB -> °C
+    float tempOffset;  // °C at raw 0
+    float mag;         // LSB -> µTesla
+};
 /****************************************************************************************************** */
 /**
  * @class :IMUService
@@ -155,6 +171,42 @@ public:
      */
     IMUData   getAll();
 
+    /**
+     * @brief :Attach a temperature bias compensator.
+     * 
+     * When set, raw accel/gyro samples are corrected before scaling. getAll()
+     * and getTemperature() refresh the compensator with the die temperature;
+     * getAccelerometer() and getGyroscope() reuse the last refreshed biases.
+     * 
+     * @param comp :Pointer to the compensator, or nullptr to disable.
+     */
+    void setTempCompensator(TempCompensator *comp);
+
+    /**
+     * @brief :Attach a sample publisher.
+     * 
+     * When set, every successful getAll() is published once so other
+     * consumers can read it without touching the bus.
+     * 
+     * @param publisher :Pointer to the publisher, or nullptr to disable.
+     */
+    void setPublisher(SamplePublisher *publisher);
+
+    /**
+     * @brief :Time from MCU boot to the first successfully read sample.
+     * 
+     * begin() only returns once the HAL is READY, so this sample already has
+     * settled gyro output, not just accel data.
+     * 
+     * @return :Microseconds since boot, or 0 if no sample has been read yet.
+     */
+    uint32_t timeToFirstSample_us() const { return firstSample_us_; }
+
+    /**
+     * @brief :Scale factors this service applies, for deferred conversion of raw data.
+     */
+    SampleScale sampleScale() const;
+
 private:
     MPU9250_HAL &hal_;
 
@@ -162,6 +214,12 @@ private:
     const float gyroScale_;  // LSB -> deg/s
     const float magScale_;   // LSB -> µTesla (scaling from AK8963)
     const float tempScale_;
+
+    TempCompensator *tempComp_;
+    SamplePublisher *publisher_;
+    uint32_t firstSample_us_;
+
+    void markSample();
 };
 
 #endif // IMU_SERVICE_HPP
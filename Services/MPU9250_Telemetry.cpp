@@ -0,0 +1,174 @@
+#include "MPU9250_Telemetry.hpp"
+
+namespace
+{
+    constexpr uint32_t POW10[] =
+    {
+        1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+    };
+
+    static_assert((TELEMETRY_TX_BYTES & (TELEMETRY_TX_BYTES - 1)) == 0,
+                  "TELEMETRY_TX_BYTES must be a power of two");
+}
+
+/* ************************************** TelemetryLine **************************************** */
+
+TelemetryLine::TelemetryLine(char *buffer, size_t capacity)
+: buffer_(buffer), capacity_(capacity), length_(0), overflowed_(false)
+{
+    if (capacity_ != 0)
+    {
+        buffer_[0] = '\0';
+    }
+}
+
+TelemetryLine &TelemetryLine::clear()
+{
+    length_     = 0;
+    overflowed_ = false;
+    if (capacity_ != 0)
+    {
+        buffer_[0] = '\0';
+    }
+    return *this;
+}
+
+TelemetryLine &TelemetryLine::put(char c)
+{
+    if ((length_ + 1) >= capacity_)
+    {
+        overflowed_ = true;
+        return *this;
+    }
+    buffer_[length_++] = c;
+    buffer_[length_]   = '\0';
+    return *this;
+}
+
+TelemetryLine &TelemetryLine::text(const char *s)
+{
+    while (*s != '\0')
+    {
+        put(*s++);
+    }
+    return *this;
+}
+
+TelemetryLine &TelemetryLine::integer(int32_t value)
+{
+    return fixedPoint(value, 0);
+}
+
+TelemetryLine &TelemetryLine::fixedPoint(int32_t scaled, uint8_t decimals)
+{
+    if (decimals > 9)
+    {
+        decimals = 9;
+    }
+
+    /* Work on the magnitude as unsigned so INT32_MIN is printable */
+    uint32_t magnitude = (scaled < 0) ? (0u - (uint32_t)scaled) : (uint32_t)scaled;
+    if (scaled < 0)
+    {
+        put('-');
+    }
+
+    uint32_t whole = magnitude / POW10[decimals];
+    uint32_t frac  = magnitude % POW10[decimals];
+
+    char digits[10];
+    uint8_t n = 0;
+    do
+    {
+        digits[n++] = (char)('0' + (whole % 10u));
+        whole /= 10u;
+    } while (whole != 0);
+
+    while (n != 0)
+    {
+        put(digits[--n]);
+    }
+
+    if (decimals != 0)
+    {
+        put('.');
+        for (uint8_t d = decimals; d != 0; d--)
+        {
+            put((char)('0' + ((frac / POW10[d - 1]) % 10u)));
+        }
+    }
+
+    return *this;
+}
+
+TelemetryLine &TelemetryLine::fixed(float value, uint8_t decimals)
+{
+    if (value != value)
+    {
+        return text("nan");
+    }
+    if (decimals > 6)
+    {
+        decimals = 6;
+    }
+
+    float scaled = value * (float)POW10[decimals];
+    if (scaled >= 2147483520.0f)
+    {
+        scaled = 2147483520.0f;
+    }
+    if (scaled <= -2147483520.0f)
+    {
+        scaled = -2147483520.0f;
+    }
+
+    int32_t rounded = (int32_t)((scaled >= 0.0f) ? (scaled + 0.5f) : (scaled - 0.5f));
+    return fixedPoint(rounded, decimals);
+}
+
+/* ************************************** TelemetryWriter **************************************** */
+
+TelemetryWriter::TelemetryWriter(uart_inst_t *uart)
+: uart_(uart), head_(0), tail_(0), dropped_(0)
+{ }
+
+bool TelemetryWriter::begin(uint tx_pin, uint32_t baudrate_hz)
+{
+    if (uart_init(uart_, baudrate_hz) == 0)
+    {
+        return false;
+    }
+    gpio_set_function(tx_pin, GPIO_FUNC_UART);
+    return true;
+}
+
+bool TelemetryWriter::writeLine(const TelemetryLine &line)
+{
+    service();
+
+    const size_t len = line.length();
+    if (len > (TELEMETRY_TX_BYTES - (head_ - tail_)))
+    {
+        dropped_++;
+        return false;
+    }
+
+    const char *src = line.data();
+    for (size_t i = 0; i < len; i++)
+    {
+        tx_[(head_ + i) & (TELEMETRY_TX_BYTES - 1)] = src[i];
+    }
+    head_ += len;
+
+    service();
+    return true;
+}
+
+void TelemetryWriter::service()
+{
+    while ((tail_ != head_) && uart_is_writable(uart_))
+    {
+        uart_putc_raw(uart_, tx_[tail_ & (TELEMETRY_TX_BYTES - 1)]);
+        tail_++;
+    }
+}
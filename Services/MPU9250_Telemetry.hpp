@@ -0,0 +1,161 @@
+/**
+ * @file  :MPU9250_Telemetry.hpp
+ * @brief :Allocation-free telemetry formatting and non-blocking UART output.
+ *
+ * Replaces <iostream> for sensor telemetry. TelemetryLine formats text,
+ * integers and fixed-point numbers into a caller-provided buffer; nothing
+ * touches the heap, locales or stream buffers. TelemetryWriter queues whole
+ * lines into a static ring and drains it into the UART TX FIFO only while
+ * the FIFO has room, so the caller never blocks on the serial port.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef IMU_TELEMETRY_HPP
+#define IMU_TELEMETRY_HPP
+
+/****************************************** include part ********************************************* */
+#include <cstdint>
+#include <cstddef>
+#include "pico/stdlib.h"
+#include "hardware/uart.h"
+/**************************************** User Data Types Part *************************************** */
+
+/* Bytes queued by TelemetryWriter (power of two) */
+constexpr size_t TELEMETRY_TX_BYTES = 256;
+/****************************************************************************************************** */
+/**
+ * @class :TelemetryLine
+ * @brief :Formats one line of telemetry into a caller-provided buffer.
+ *
+ * Calls chain: line.text("Acc(g): ").fixed(x, 3).newline(). Output that does
+ * not fit is dropped and overflowed() reports it; the buffer always stays
+ * NUL-terminated.
+ */
+class TelemetryLine
+{
+public:
+    /**
+     * @brief :Constructor for TelemetryLine.
+     *
+     * @param buffer   :Storage for the line (typically a static array).
+     * @param capacity :Size of buffer in bytes, including the terminator.
+     */
+    TelemetryLine(char *buffer, size_t capacity);
+
+    /**
+     * @brief :Empty the line.
+     */
+    TelemetryLine &clear();
+
+    /**
+     * @brief :Append a NUL-terminated string.
+     */
+    TelemetryLine &text(const char *s);
+
+    /**
+     * @brief :Append a signed decimal integer.
+     */
+    TelemetryLine &integer(int32_t value);
+
+    /**
+     * @brief :Append a fixed-point number stored as an integer.
+     *
+     * @param scaled    :Value multiplied by 10^decimals (e.g. 1234 with 3 -> "1.234").
+     * @param decimals  :Digits after the decimal point (0..9).
+     */
+    TelemetryLine &fixedPoint(int32_t scaled, uint8_t decimals);
+
+    /**
+     * @brief :Append a float rounded to a fixed number of decimals.
+     *
+     * Converted once to a scaled integer, then printed with fixedPoint().
+     *
+     * @param value    :Value to print; must fit in int32 once scaled.
+     * @param decimals :Digits after the decimal point (0..6).
+     */
+    TelemetryLine &fixed(float value, uint8_t decimals);
+
+    /**
+     * @brief :Append a single character.
+     */
+    TelemetryLine &put(char c);
+
+    /**
+     * @brief :Append '\n'.
+     */
+    TelemetryLine &newline() { return put('\n'); }
+
+    const char *data() const { return buffer_; }
+    size_t length() const { return length_; }
+    bool overflowed() const { return overflowed_; }
+
+private:
+    char  *buffer_;
+    size_t capacity_;
+    size_t length_;
+    bool   overflowed_;
+};
+
+/**
+ * @class :TelemetryWriter
+ * @brief :Queues whole lines and drains them to a UART without blocking.
+ *
+ * writeLine() either queues the complete line or drops it (counted in
+ * dropped()); a line is never split. service() moves queued bytes into the
+ * UART TX FIFO while it has room and must be called from the main loop.
+ */
+class TelemetryWriter
+{
+public:
+    /**
+     * @brief :Constructor for TelemetryWriter.
+     *
+     * @param uart :UART instance (e.g., uart0).
+     */
+    explicit TelemetryWriter(uart_inst_t *uart);
+
+    /**
+     * @brief :Initialize the UART and route the TX pin.
+     *
+     * @param tx_pin      :GPIO pin for UART TX.
+     * @param baudrate_hz :Baudrate in Hz (e.g., 115200).
+     * @return :true if initialization succeeded, false otherwise.
+     */
+    bool begin(uint tx_pin, uint32_t baudrate_hz);
+
+    /**
+     * @brief :Queue a line for transmission.
+     *
+     * @param line :Formatted line.
+     * @return :true if queued, false if the queue lacked room (line dropped).
+     */
+    bool writeLine(const TelemetryLine &line);
+
+    /**
+     * @brief :Move queued bytes into the UART FIFO while it accepts them.
+     */
+    void service();
+
+    /**
+     * @brief :true while queued bytes remain.
+     */
+    bool busy() const { return head_ != tail_; }
+
+    /**
+     * @brief :Number of lines dropped because the queue was full.
+     */
+    uint32_t dropped() const { return dropped_; }
+
+private:
+    uart_inst_t *uart_;
+    char     tx_[TELEMETRY_TX_BYTES];
+    uint32_t head_;     // next write, free-running
+    uint32_t tail_;     // next read, free-running
+    uint32_t dropped_;
+};
+
+#endif // IMU_TELEMETRY_HPP
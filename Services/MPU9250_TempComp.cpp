@@ -0,0 +1,253 @@
+#include "MPU9250_TempComp.hpp"
+#include <cmath>
+#include <cfloat>
+
+namespace
+{
+    int16_t saturate16(int32_t v)
+    {
+        if (v > INT16_MAX)
+        {
+            return INT16_MAX;
+        }
+        if (v < INT16_MIN)
+        {
+            return INT16_MIN;
+        }
+        return (int16_t)v;
+    }
+}
+
+/* ************************************** TempBiasBuilder **************************************** */
+
+TempBiasBuilder::TempBiasBuilder(float tempStart_c, float tempStep_c)
+: tempStart_cC_((int16_t)lroundf(tempStart_c * 100.0f)),
+  tempStep_cC_((uint16_t)lroundf(tempStep_c * 100.0f))
+{
+    for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+    {
+        reference_[a] = 0;
+    }
+    reset();
+}
+
+void TempBiasBuilder::setReference(const int16_t reference[TC_AXIS_COUNT])
+{
+    for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+    {
+        reference_[a] = reference[a];
+    }
+}
+
+void TempBiasBuilder::addSample(float temp_c, const int16_t raw[TC_AXIS_COUNT])
+{
+    if (tempStep_cC_ == 0)
+    {
+        return;
+    }
+
+    /* Nearest breakpoint; samples outside the table land in the end bins */
+    const int32_t temp_cC = (int32_t)lroundf(temp_c * 100.0f);
+    long bin = lroundf((float)(temp_cC - tempStart_cC_) / tempStep_cC_);
+    if (bin < 0)
+    {
+        bin = 0;
+    }
+    if (bin >= TEMP_COMP_POINTS)
+    {
+        bin = TEMP_COMP_POINTS - 1;
+    }
+
+    if (count_[bin] == UINT16_MAX)
+    {
+        return;
+    }
+
+    for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+    {
+        sum_[a][bin] += (int32_t)raw[a] - reference_[a];
+    }
+    sumOffset_cC_[bin] += saturate16(temp_cC - (tempStart_cC_ + (int32_t)bin * tempStep_cC_));
+    count_[bin]++;
+}
+
+float TempBiasBuilder::meanBias(uint8_t axis, uint8_t bin) const
+{
+    return (float)sum_[axis][bin] / count_[bin];
+}
+
+bool TempBiasBuilder::build(TempBiasTable &table) const
+{
+    table.tempStart_cC = tempStart_cC_;
+    table.tempStep_cC  = tempStep_cC_;
+
+    /* Populated bins and where their mean temperature sits, in breakpoint units */
+    uint8_t used[TEMP_COMP_POINTS];
+    float   pos[TEMP_COMP_POINTS];
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < TEMP_COMP_POINTS; i++)
+    {
+        if (count_[i] != 0)
+        {
+            used[n] = i;
+            pos[n]  = i + ((float)sumOffset_cC_[i] / count_[i]) / tempStep_cC_;
+            n++;
+        }
+    }
+
+    if (n == 0)
+    {
+        return false;
+    }
+
+    for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+    {
+        for (uint8_t i = 0; i < TEMP_COMP_POINTS; i++)
+        {
+            if (n == 1)
+            {
+                table.bias[a][i] = saturate16(lroundf(meanBias(a, used[0])));
+                continue;
+            }
+
+            /* Held flat beyond the populated range */
+            float x = i;
+            if (i < used[0])
+            {
+                x = used[0];
+            }
+            if (i > used[n - 1])
+            {
+                x = used[n - 1];
+            }
+
+            /* Segment between consecutive populated bins; the end segments also extrapolate */
+            uint8_t k = 0;
+            while (((k + 2) < n) && (pos[k + 1] <= x))
+            {
+                k++;
+            }
+
+            const float b0   = meanBias(a, used[k]);
+            const float b1   = meanBias(a, used[k + 1]);
+            const float span = pos[k + 1] - pos[k];
+            const float v    = (span > 1e-3f) ? (b0 + (b1 - b0) * (x - pos[k]) / span) : (0.5f * (b0 + b1));
+            table.bias[a][i] = saturate16(lroundf(v));
+        }
+    }
+
+    return true;
+}
+
+void TempBiasBuilder::reset()
+{
+    for (uint8_t i = 0; i < TEMP_COMP_POINTS; i++)
+    {
+        for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+        {
+            sum_[a][i] = 0;
+        }
+        sumOffset_cC_[i] = 0;
+        count_[i]        = 0;
+    }
+}
+
+/* ************************************** TempCompensator **************************************** */
+
+TempCompensator::TempCompensator(const TempBiasTable &table)
+: table_(table),
+  lastTemp_c_(NAN),
+  segLo_c_(0.0f),
+  segHi_c_(0.0f), // empty segment forces a search on the first update
+  origin_c_(0.0f)
+{
+    for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+    {
+        base_[a]  = 0.0f;
+        slope_[a] = 0.0f;
+        bias_[a]  = 0;
+    }
+}
+
+void TempCompensator::selectSegment(float temp_c)
+{
+    const float start = table_.tempStart_cC / 100.0f;
+    const float step  = table_.tempStep_cC / 100.0f;
+    const float end   = start + step * (TEMP_COMP_POINTS - 1);
+
+    /* Outside the table the bias is held at the nearest end point */
+    if ((step <= 0.0f) || (temp_c < start))
+    {
+        segLo_c_  = -FLT_MAX;
+        segHi_c_  = start;
+        origin_c_ = start;
+        for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+        {
+            base_[a]  = table_.bias[a][0];
+            slope_[a] = 0.0f;
+        }
+        return;
+    }
+    if (temp_c >= end)
+    {
+        segLo_c_  = end;
+        segHi_c_  = FLT_MAX;
+        origin_c_ = end;
+        for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+        {
+            base_[a]  = table_.bias[a][TEMP_COMP_POINTS - 1];
+            slope_[a] = 0.0f;
+        }
+        return;
+    }
+
+    uint8_t i = (uint8_t)((temp_c - start) / step);
+    if (i > TEMP_COMP_POINTS - 2)
+    {
+        i = TEMP_COMP_POINTS - 2;
+    }
+
+    segLo_c_  = start + step * i;
+    segHi_c_  = segLo_c_ + step;
+    origin_c_ = segLo_c_;
+    for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+    {
+        base_[a]  = table_.bias[a][i];
+        slope_[a] = (table_.bias[a][i + 1] - table_.bias[a][i]) / step;
+    }
+}
+
+void TempCompensator::update(float temp_c)
+{
+    /* NaN compares false, so the first update always evaluates */
+    if ((fabsf(temp_c - lastTemp_c_) < TEMP_COMP_DEADBAND_C) || std::isnan(temp_c))
+    {
+        return;
+    }
+    lastTemp_c_ = temp_c;
+
+    if ((temp_c < segLo_c_) || (temp_c >= segHi_c_))
+    {
+        selectSegment(temp_c);
+    }
+
+    const float dt = temp_c - origin_c_;
+    for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+    {
+        bias_[a] = saturate16(lroundf(base_[a] + slope_[a] * dt));
+    }
+}
+
+void TempCompensator::correctAccel(int16_t &ax, int16_t &ay, int16_t &az) const
+{
+    ax = saturate16((int32_t)ax - bias_[TC_ACCEL_X]);
+    ay = saturate16((int32_t)ay - bias_[TC_ACCEL_Y]);
+    az = saturate16((int32_t)az - bias_[TC_ACCEL_Z]);
+}
+
+void TempCompensator::correctGyro(int16_t &gx, int16_t &gy, int16_t &gz) const
+{
+    gx = saturate16((int32_t)gx - bias_[TC_GYRO_X]);
+    gy = saturate16((int32_t)gy - bias_[TC_GYRO_Y]);
+    gz = saturate16((int32_t)gz - bias_[TC_GYRO_Z]);
+}
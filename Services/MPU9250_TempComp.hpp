@@ -0,0 +1,187 @@
+/**
+ * @file  :MPU9250_TempComp.hpp
+ * @brief :Temperature-compensated bias correction for the MPU9250 accel/gyro.
+ *
+ * Accelerometer and gyroscope biases drift with die temperature. This header
+ * defines a compact per-axis bias-versus-temperature table, a builder that
+ * fills the table from logged static data, and a compensator that removes
+ * the interpolated bias from every raw sample.
+ *
+ * The compensator works in the raw LSB domain so it can sit between the HAL
+ * and the scaling done in IMUService. Temperature changes slowly, so the
+ * active table segment and the evaluated biases are cached and only
+ * re-evaluated once the reading has moved by TEMP_COMP_DEADBAND_C; the
+ * per-sample cost is a float subtract and compare plus six saturating integer
+ * subtractions.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef IMU_TEMP_COMP_HPP
+#define IMU_TEMP_COMP_HPP
+
+/****************************************** include part ********************************************* */
+#include <cstdint>
+/**************************************** User Data Types Part *************************************** */
+
+/* Number of temperature breakpoints held per axis */
+constexpr uint8_t TEMP_COMP_POINTS = 16;
+
+/* Temperature change (°C) that triggers a bias re-evaluation; ~21 LSB of the die sensor, above its noise */
+constexpr float TEMP_COMP_DEADBAND_C = 1.0f / 16.0f;
+
+/**
+ * @enum  :TempCompAxis
+ * @brief :Axis index inside a TempBiasTable.
+ */
+enum TempCompAxis : uint8_t
+{
+    TC_ACCEL_X = 0,
+    TC_ACCEL_Y,
+    TC_ACCEL_Z,
+    TC_GYRO_X,
+    TC_GYRO_Y,
+    TC_GYRO_Z,
+    TC_AXIS_COUNT
+};
+
+/**
+ * @struct :TempBiasTable
+ * @brief  :Bias (raw LSB) sampled at uniformly spaced temperature breakpoints.
+ *
+ * Breakpoint i sits at tempStart_cC + i * tempStep_cC (centi-degrees Celsius).
+ * The whole table is 196 bytes and can be stored as-is in flash.
+ */
+struct TempBiasTable
+{
+    int16_t  tempStart_cC;
+    uint16_t tempStep_cC;
+    int16_t  bias[TC_AXIS_COUNT][TEMP_COMP_POINTS];
+};
+/****************************************************************************************************** */
+/**
+ * @class :TempBiasBuilder
+ * @brief :Builds a TempBiasTable from logged static samples.
+ *
+ * Feed raw samples captured while the sensor is held still and the enclosure
+ * warms up. Each bin keeps the mean bias and the mean temperature of its
+ * samples, and the breakpoints are read off the piecewise-linear curve
+ * through those means. A bin whose samples sit off its breakpoint (typically
+ * the first and last bins of a warm-up log) therefore does not shift the
+ * table; the end breakpoints of the populated range are extrapolated from
+ * their nearest segment. Bins without data are interpolated between their
+ * populated neighbours and held flat beyond the first/last populated bin.
+ */
+class TempBiasBuilder
+{
+public:
+    /**
+     * @brief :Constructor for TempBiasBuilder.
+     *
+     * @param tempStart_c :Temperature of the first breakpoint in °C.
+     * @param tempStep_c  :Spacing between breakpoints in °C (must be > 0).
+     */
+    TempBiasBuilder(float tempStart_c, float tempStep_c);
+
+    /**
+     * @brief :Set the raw value each axis should read when bias free.
+     *
+     * Defaults to zero on every axis. For the accelerometer this is the
+     * gravity vector of the logging pose, e.g. {0, 0, 16384} flat at ±2g.
+     *
+     * @param reference :Expected raw value per TempCompAxis.
+     */
+    void setReference(const int16_t reference[TC_AXIS_COUNT]);
+
+    /**
+     * @brief :Accumulate one logged sample.
+     *
+     * @param temp_c :Die temperature in °C at the time of the sample.
+     * @param raw    :Raw accel/gyro values ordered as TempCompAxis.
+     */
+    void addSample(float temp_c, const int16_t raw[TC_AXIS_COUNT]);
+
+    /**
+     * @brief :Average the bins and write the resulting table.
+     *
+     * @param table :Destination table.
+     * @return :true if at least one bin held data, false otherwise.
+     */
+    bool build(TempBiasTable &table) const;
+
+    /**
+     * @brief :Drop every accumulated sample.
+     */
+    void reset();
+
+private:
+    int16_t  tempStart_cC_;
+    uint16_t tempStep_cC_;
+    int16_t  reference_[TC_AXIS_COUNT];
+    int32_t  sum_[TC_AXIS_COUNT][TEMP_COMP_POINTS];
+    int32_t  sumOffset_cC_[TEMP_COMP_POINTS];  // sample temperature minus the bin's breakpoint
+    uint16_t count_[TEMP_COMP_POINTS];
+
+    float meanBias(uint8_t axis, uint8_t bin) const;
+};
+
+/**
+ * @class :TempCompensator
+ * @brief :Applies a TempBiasTable to raw samples.
+ *
+ * Call update() with the latest temperature, then correctAccel() /
+ * correctGyro() on each raw sample. update() only recomputes the biases when
+ * the temperature has moved by at least TEMP_COMP_DEADBAND_C since the last
+ * evaluation, so sensor noise does not trigger a recompute on every sample,
+ * and only searches the table when the temperature leaves the cached segment.
+ */
+class TempCompensator
+{
+public:
+    /**
+     * @brief :Constructor for TempCompensator.
+     *
+     * @param table :Bias table; must outlive the compensator.
+     */
+    explicit TempCompensator(const TempBiasTable &table);
+
+    /**
+     * @brief :Refresh the active biases for a new temperature reading.
+     *
+     * @param temp_c :Die temperature in °C.
+     */
+    void update(float temp_c);
+
+    /**
+     * @brief :Remove the current accelerometer bias from a raw sample.
+     */
+    void correctAccel(int16_t &ax, int16_t &ay, int16_t &az) const;
+
+    /**
+     * @brief :Remove the current gyroscope bias from a raw sample.
+     */
+    void correctGyro(int16_t &gx, int16_t &gy, int16_t &gz) const;
+
+    /**
+     * @brief :Current bias for one axis in raw LSB.
+     */
+    int16_t bias(TempCompAxis axis) const { return bias_[axis]; }
+
+private:
+    const TempBiasTable &table_;
+
+    float   lastTemp_c_;  // temperature the cached biases were evaluated at
+    float   segLo_c_;     // cached segment [segLo_c_, segHi_c_)
+    float   segHi_c_;
+    float   origin_c_;    // breakpoint the segment coefficients are relative to
+    float   base_[TC_AXIS_COUNT];   // bias at origin_c_
+    float   slope_[TC_AXIS_COUNT];  // LSB per °C inside the segment
+    int16_t bias_[TC_AXIS_COUNT];
+
+    void selectSegment(float temp_c);
+};
+
+#endif // IMU_TEMP_COMP_HPP
@@ -0,0 +1,411 @@
+#include "MPU9250_Vibration.hpp"
+#include <cmath>
+
+namespace
+{
+    constexpr uint16_t HALF_SIZE = VIB_FFT_SIZE / 2;
+    constexpr double   PI        = 3.14159265358979323846;
+
+    static_assert((VIB_FFT_SIZE & (VIB_FFT_SIZE - 1)) == 0, "VIB_FFT_SIZE must be a power of two");
+
+    /* Taylor series, accurate to well below one Q15 LSB for |x| <= 2*pi */
+    constexpr double ctSin(double x)
+    {
+        double term = x;
+        double sum  = x;
+        for (int n = 1; n < 16; n++)
+        {
+            term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+            sum  += term;
+        }
+        return sum;
+    }
+
+    constexpr double ctCos(double x)
+    {
+        return ctSin((PI / 2.0) - x);
+    }
+
+    constexpr int16_t toQ15(double v)
+    {
+        double s = v * 32767.0;
+        return (int16_t)((s >= 0.0) ? (s + 0.5) : (s - 0.5));
+    }
+
+    /**
+     * Compile-time tables:
+     *  - cos/sin of 2*pi*k/N for k < N/2, shared by the N/2 complex FFT
+     *    (which uses every other entry) and the real-split step,
+     *  - periodic Hann window,
+     *  - bit-reversal permutation of the N/2 complex points.
+     */
+    struct SpectralTables
+    {
+        int16_t  cos[HALF_SIZE];
+        int16_t  sin[HALF_SIZE];
+        int16_t  window[VIB_FFT_SIZE];
+        uint16_t bitrev[HALF_SIZE];
+        double   windowPower; // mean of w^2
+    };
+
+    constexpr SpectralTables makeTables()
+    {
+        SpectralTables t{};
+
+        for (uint16_t k = 0; k < HALF_SIZE; k++)
+        {
+            double a = 2.0 * PI * k / VIB_FFT_SIZE;
+            t.cos[k] = toQ15(ctCos(a));
+            t.sin[k] = toQ15(ctSin(a));
+        }
+
+        double power = 0.0;
+        for (uint16_t n = 0; n < VIB_FFT_SIZE; n++)
+        {
+            t.window[n] = toQ15(0.5 - 0.5 * ctCos(2.0 * PI * n / VIB_FFT_SIZE));
+            double w = t.window[n] / 32767.0;
+            power += w * w;
+        }
+        t.windowPower = power / VIB_FFT_SIZE;
+
+        uint16_t bits = 0;
+        for (uint16_t m = HALF_SIZE; m > 1; m >>= 1)
+        {
+            bits++;
+        }
+        for (uint16_t i = 0; i < HALF_SIZE; i++)
+        {
+            uint16_t r = 0;
+            for (uint16_t b = 0; b < bits; b++)
+            {
+                r |= ((i >> b) & 1u) << (bits - 1 - b);
+            }
+            t.bitrev[i] = r;
+        }
+
+        return t;
+    }
+
+    constexpr SpectralTables TABLES = makeTables();
+
+    static_assert(TABLES.cos[0] == 32767, "twiddle table must start at W^0 = 1");
+    static_assert(TABLES.sin[HALF_SIZE / 2] == 32767, "twiddle table quarter-wave must be sin(pi/2)");
+    static_assert(TABLES.window[0] == 0, "Hann window must start at zero");
+    static_assert(TABLES.window[VIB_FFT_SIZE / 2] == 32767, "Hann window must peak mid-window");
+
+    /**
+     * In-place radix-2 DIT complex FFT over HALF_SIZE interleaved Q15 points.
+     * Every stage halves its output, so the result is FFT(x) / HALF_SIZE and
+     * cannot overflow for inputs below 2^14.
+     */
+    void fftQ15(int16_t *data)
+    {
+        for (uint16_t i = 0; i < HALF_SIZE; i++)
+        {
+            uint16_t j = TABLES.bitrev[i];
+            if (i < j)
+            {
+                int16_t re = data[2 * i];
+                int16_t im = data[2 * i + 1];
+                data[2 * i]     = data[2 * j];
+                data[2 * i + 1] = data[2 * j + 1];
+                data[2 * j]     = re;
+                data[2 * j + 1] = im;
+            }
+        }
+
+        for (uint16_t len = 2; len <= HALF_SIZE; len <<= 1)
+        {
+            const uint16_t half   = len >> 1;
+            const uint16_t stride = VIB_FFT_SIZE / len; // W_{N/2}^j == W_N^(2j)
+
+            for (uint16_t i = 0; i < HALF_SIZE; i += len)
+            {
+                for (uint16_t j = 0; j < half; j++)
+                {
+                    const int32_t c = TABLES.cos[j * stride];
+                    const int32_t s = TABLES.sin[j * stride];
+
+                    int16_t *a = &data[2 * (i + j)];
+                    int16_t *b = &data[2 * (i + j + half)];
+
+                    /* t = b * (cos - j sin) */
+                    const int32_t tr = (c * b[0] + s * b[1]) >> 15;
+                    const int32_t ti = (c * b[1] - s * b[0]) >> 15;
+
+                    const int32_t ar = a[0];
+                    const int32_t ai = a[1];
+
+                    a[0] = (int16_t)((ar + tr) >> 1);
+                    a[1] = (int16_t)((ai + ti) >> 1);
+                    b[0] = (int16_t)((ar - tr) >> 1);
+                    b[1] = (int16_t)((ai - ti) >> 1);
+                }
+            }
+        }
+    }
+}
+
+VibrationAnalyzer::VibrationAnalyzer(const VibrationConfig &config)
+: config_(),
+  result_(),
+  bandBin_(),
+  maxWindowCycles_(0),
+  cycleCounter_(nullptr)
+{
+    config_.sampleRate_hz = 1000.0f;
+    config_.hop           = VIB_FFT_SIZE / 2;
+    config_.accelScale    = 1.0f / 16384.0f;
+    config_.bandCount     = 0;
+
+    reset();
+    configure(config);
+}
+
+void VibrationAnalyzer::setCycleCounter(CycleCounter *counter)
+{
+    cycleCounter_ = counter;
+}
+
+bool VibrationAnalyzer::configure(const VibrationConfig &config)
+{
+    if ((config.sampleRate_hz <= 0.0f) ||
+        (config.hop == 0) || (config.hop > VIB_FFT_SIZE) ||
+        (config.bandCount > VIB_MAX_BANDS))
+    {
+        return false;
+    }
+
+    for (uint8_t b = 0; b < config.bandCount; b++)
+    {
+        if (config.bandEdges_hz[b + 1] <= config.bandEdges_hz[b])
+        {
+            return false;
+        }
+    }
+
+    config_ = config;
+
+    /* Band b covers FFT bins [bandBin_[b], bandBin_[b + 1]) */
+    const float binsPerHz = VIB_FFT_SIZE / config_.sampleRate_hz;
+    for (uint8_t b = 0; b <= config_.bandCount; b++)
+    {
+        float bin = ceilf(config_.bandEdges_hz[b] * binsPerHz);
+        if (bin < 0.0f)
+        {
+            bin = 0.0f;
+        }
+        if (bin > HALF_SIZE + 1)
+        {
+            bin = HALF_SIZE + 1;
+        }
+        bandBin_[b] = (uint16_t)bin;
+    }
+
+    reset();
+    return true;
+}
+
+void VibrationAnalyzer::reset()
+{
+    head_        = 0;
+    filled_      = 0;
+    sinceWindow_ = 0;
+}
+
+bool VibrationAnalyzer::pushSample(int16_t sample)
+{
+    history_[head_] = sample;
+    head_ = (head_ + 1) & (VIB_FFT_SIZE - 1);
+
+    if (filled_ < VIB_FFT_SIZE)
+    {
+        filled_++;
+    }
+    if (sinceWindow_ < config_.hop)
+    {
+        sinceWindow_++;
+    }
+
+    if ((filled_ < VIB_FFT_SIZE) || (sinceWindow_ < config_.hop))
+    {
+        return false;
+    }
+
+    sinceWindow_ = 0;
+    analyzeWindow();
+    return true;
+}
+
+size_t VibrationAnalyzer::pushBlock(const int16_t *samples, size_t count, size_t stride)
+{
+    size_t windows = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (pushSample(samples[i * stride]))
+        {
+            windows++;
+        }
+    }
+    return windows;
+}
+
+void VibrationAnalyzer::analyzeWindow()
+{
+    const bool     timed      = (cycleCounter_ != nullptr) && cycleCounter_->running();
+    const uint32_t startTicks = timed ? cycleCounter_->read() : 0;
+
+    /* head_ points at the oldest sample once the history is full */
+    int32_t sum   = 0;
+    int64_t sumSq = 0;
+    for (uint16_t n = 0; n < VIB_FFT_SIZE; n++)
+    {
+        int32_t s = history_[(head_ + n) & (VIB_FFT_SIZE - 1)];
+        sum   += s;
+        sumSq += s * s;
+    }
+
+    const float meanF = (float)sum / VIB_FFT_SIZE;
+    float variance    = (float)sumSq / VIB_FFT_SIZE - meanF * meanF;
+    if (variance < 0.0f)
+    {
+        variance = 0.0f;
+    }
+    result_.rms_g = sqrtf(variance) * config_.accelScale;
+
+    const int32_t mean = (int32_t)lroundf(meanF);
+
+    /*
+     * Block scaling: bring the largest windowed value into [2^13, 2^14).
+     * The scale is taken from the full Q15 window product, so small signals
+     * keep their resolution instead of being truncated before the shift.
+     */
+    uint32_t maxAbs = 0;
+    for (uint16_t n = 0; n < VIB_FFT_SIZE; n++)
+    {
+        int32_t  p = (history_[(head_ + n) & (VIB_FFT_SIZE - 1)] - mean) * TABLES.window[n];
+        uint32_t a = (p < 0) ? (uint32_t)-p : (uint32_t)p;
+        if (a > maxAbs)
+        {
+            maxAbs = a;
+        }
+    }
+
+    for (uint8_t b = 0; b < VIB_MAX_BANDS; b++)
+    {
+        result_.bandEnergy_g2[b] = 0.0f;
+    }
+    result_.peakFreq_hz = 0.0f;
+
+    if (maxAbs != 0)
+    {
+        /* work_ = product >> drop; relative to the Q15 windowed sample that is a gain of 2^shift */
+        int8_t drop = 0;
+        while (maxAbs >= (1u << 14))
+        {
+            maxAbs >>= 1;
+            drop++;
+        }
+        while (maxAbs < (1u << 13))
+        {
+            maxAbs <<= 1;
+            drop--;
+        }
+        const int8_t  shift = 15 - drop;
+        const int32_t round = (drop > 0) ? (1 << (drop - 1)) : 0;
+
+        /* Real samples packed as N/2 complex points: work_ = {x0, x1, x2, ...} */
+        for (uint16_t n = 0; n < VIB_FFT_SIZE; n++)
+        {
+            int32_t p = (history_[(head_ + n) & (VIB_FFT_SIZE - 1)] - mean) * TABLES.window[n];
+            /* p may be negative: scale up by multiplying, never by a left shift */
+            work_[n] = (int16_t)((drop >= 0) ? ((p + round) >> drop) : (p * (1 << -drop)));
+        }
+
+        fftQ15(work_);
+
+        /*
+         * Split step: X[k] = Fe + W^k Fo with
+         *   Fe = (Z[k] + conj(Z[N/2-k])) / 2,  Fo = (Z[k] - conj(Z[N/2-k])) / 2j
+         * Bins are visited in ascending order so bands are filled in one pass.
+         */
+        uint64_t bandAcc[VIB_MAX_BANDS] = {};
+        uint32_t peakPower = 0;
+        uint16_t peakBin   = 0;
+        uint8_t  band      = 0;
+
+        for (uint16_t k = 1; k <= HALF_SIZE; k++)
+        {
+            int32_t xr;
+            int32_t xi;
+            if (k == HALF_SIZE)
+            {
+                xr = work_[0] - work_[1];
+                xi = 0;
+            }
+            else
+            {
+                const int32_t a = work_[2 * k];
+                const int32_t b = work_[2 * k + 1];
+                const int32_t c = work_[2 * (HALF_SIZE - k)];
+                const int32_t d = work_[2 * (HALF_SIZE - k) + 1];
+
+                const int32_t feR = a + c; // 2 * Fe
+                const int32_t feI = b - d;
+                const int32_t foR = b + d; // 2 * Fo
+                const int32_t foI = c - a;
+
+                const int32_t cw = TABLES.cos[k];
+                const int32_t sw = TABLES.sin[k];
+
+                xr = (feR + ((cw * foR + sw * foI) >> 15)) >> 1;
+                xi = (feI + ((cw * foI - sw * foR) >> 15)) >> 1;
+            }
+
+            const uint32_t ur = (uint32_t)((xr < 0) ? -xr : xr);
+            const uint32_t ui = (uint32_t)((xi < 0) ? -xi : xi);
+            uint32_t power = ur * ur + ui * ui;
+
+            if (power > peakPower)
+            {
+                peakPower = power;
+                peakBin   = k;
+            }
+
+            if (k == HALF_SIZE)
+            {
+                power >>= 1; // Nyquist has no mirrored half
+            }
+
+            while ((band < config_.bandCount) && (k >= bandBin_[band + 1]))
+            {
+                band++;
+            }
+            if ((band < config_.bandCount) && (k >= bandBin_[band]))
+            {
+                bandAcc[band] += power;
+            }
+        }
+
+        /*
+         * One-sided mean square per bin is |X|^2 / 2 in the scaled domain;
+         * undo the block shift and the Hann power loss, then convert to g^2.
+         */
+        const float factor = ldexpf(1.0f, -2 * shift) * config_.accelScale * config_.accelScale /
+                             (2.0f * (float)TABLES.windowPower);
+
+        for (uint8_t b = 0; b < config_.bandCount; b++)
+        {
+            result_.bandEnergy_g2[b] = (float)bandAcc[b] * factor;
+        }
+        result_.peakFreq_hz = peakBin * config_.sampleRate_hz / VIB_FFT_SIZE;
+    }
+
+    result_.sequence++;
+
+    result_.windowCycles = timed ? CycleCounter::elapsed(startTicks, cycleCounter_->read()) : 0;
+    if (result_.windowCycles > maxWindowCycles_)
+    {
+        maxWindowCycles_ = result_.windowCycles;
+    }
+}
@@ -0,0 +1,149 @@
+/**
+ * @file  :MPU9250_Vibration.hpp
+ * @brief :Streaming fixed-point spectral analyzer for the accelerometer channel.
+ *
+ * This header defines the VibrationAnalyzer class, which turns a continuous
+ * stream of raw accelerometer samples (polled at high ODR or drained from the
+ * FIFO) into per-window vibration metrics: energy in configurable frequency
+ * bands, the dominant (peak) frequency and the RMS level.
+ *
+ * Samples are collected into overlapping Hann-windowed blocks of
+ * VIB_FFT_SIZE points; a new window is analysed every `hop` samples. The
+ * transform is an in-place Q15 real FFT (an N/2 complex radix-2 FFT plus a
+ * split step) with block scaling, so it runs on the Cortex-M0+ without an
+ * FPU. Twiddle and window tables are generated at compile time.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef IMU_VIBRATION_HPP
+#define IMU_VIBRATION_HPP
+
+/****************************************** include part ********************************************* */
+#include "../HAL/MPU9250_CycleCounter.hpp"
+#include <cstdint>
+#include <cstddef>
+/**************************************** User Data Types Part *************************************** */
+
+/* Points per analysis window (power of two) */
+constexpr uint16_t VIB_FFT_SIZE  = 256;
+/* Maximum number of reported frequency bands */
+constexpr uint8_t  VIB_MAX_BANDS = 8;
+
+/**
+ * @struct :VibrationConfig
+ * @brief  :Run-time settings for VibrationAnalyzer.
+ */
+struct VibrationConfig
+{
+    float    sampleRate_hz;                   // rate the samples are pushed at
+    uint16_t hop;                             // samples between windows (1..VIB_FFT_SIZE)
+    float    accelScale;                      // LSB -> g, e.g. 1.0f / 16384.0f for ±2g
+    uint8_t  bandCount;                       // 0..VIB_MAX_BANDS
+    float    bandEdges_hz[VIB_MAX_BANDS + 1]; // ascending, bandCount + 1 entries
+};
+
+/**
+ * @struct :VibrationResult
+ * @brief  :Metrics computed for one analysis window.
+ */
+struct VibrationResult
+{
+    float    bandEnergy_g2[VIB_MAX_BANDS]; // mean-square acceleration per band (g²)
+    float    peakFreq_hz;                  // frequency of the strongest non-DC bin
+    float    rms_g;                        // RMS of the window with the mean removed
+    uint32_t windowCycles;                 // CPU cycles spent analysing the window (0 when not profiled)
+    uint32_t sequence;                     // increments with every window
+};
+/****************************************************************************************************** */
+/**
+ * @class :VibrationAnalyzer
+ * @brief :Overlapping-window fixed-point FFT over one accelerometer axis.
+ *
+ * Push raw samples with pushSample() or pushBlock(); whenever a push
+ * completes a window the metrics are refreshed and can be read with
+ * result(). All buffers are members, nothing is allocated.
+ */
+class VibrationAnalyzer
+{
+public:
+    /**
+     * @brief :Constructor for VibrationAnalyzer.
+     *
+     * @param config :Initial configuration (see configure()).
+     */
+    explicit VibrationAnalyzer(const VibrationConfig &config);
+
+    /**
+     * @brief :Apply a new configuration and discard buffered samples.
+     *
+     * @param config :Sample rate, hop, scale and band edges.
+     * @return :true if the configuration is valid, false otherwise
+     *         (the previous configuration is kept).
+     */
+    bool configure(const VibrationConfig &config);
+
+    /**
+     * @brief :Push one raw sample of the analysed axis.
+     *
+     * @param sample :Raw accelerometer value (LSB).
+     * @return :true if this sample completed a window and result() changed.
+     */
+    bool pushSample(int16_t sample);
+
+    /**
+     * @brief :Push a block of raw samples.
+     *
+     * @param samples :First sample of the analysed axis.
+     * @param count   :Number of samples.
+     * @param stride  :Distance between consecutive samples in int16_t units
+     *                 (1 for a channel column, 3 for interleaved x/y/z).
+     * @return :Number of windows completed while consuming the block.
+     */
+    size_t pushBlock(const int16_t *samples, size_t count, size_t stride = 1);
+
+    /**
+     * @brief :Discard buffered samples; the next window starts from scratch.
+     */
+    void reset();
+
+    /**
+     * @brief :Metrics of the most recently completed window.
+     */
+    const VibrationResult &result() const { return result_; }
+
+    /**
+     * @brief :Largest VibrationResult::windowCycles seen so far.
+     */
+    uint32_t maxWindowCycles() const { return maxWindowCycles_; }
+
+    /**
+     * @brief :Attach a cycle counter to time each window.
+     *
+     * Windows are timed only while the counter is running; the analyzer
+     * never starts or stops it, so SysTick stays under the caller's control.
+     *
+     * @param counter :Pointer to the counter, or nullptr to disable.
+     */
+    void setCycleCounter(CycleCounter *counter);
+
+private:
+    VibrationConfig config_;
+    VibrationResult result_;
+    uint16_t bandBin_[VIB_MAX_BANDS + 1]; // first FFT bin of each band
+
+    int16_t  history_[VIB_FFT_SIZE];  // circular sample history
+    int16_t  work_[VIB_FFT_SIZE];     // packed complex FFT buffer (re, im, ...)
+    uint16_t head_;                   // next write position in history_
+    uint16_t filled_;                 // valid samples in history_
+    uint16_t sinceWindow_;            // samples pushed since the last window
+    uint32_t maxWindowCycles_;
+    CycleCounter *cycleCounter_;
+
+    void analyzeWindow();
+};
+
+#endif // IMU_VIBRATION_HPP
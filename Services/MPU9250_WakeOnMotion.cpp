@@ -0,0 +1,183 @@
+#include "MPU9250_WakeOnMotion.hpp"
+#include "MPU9250_AdaptiveRate.hpp"
+#include "hardware/gpio.h"
+
+using namespace MPU9250Reg;
+
+WakeOnMotionEngine *WakeOnMotionEngine::irqOwner_ = nullptr;
+
+WakeOnMotionEngine::WakeOnMotionEngine(MPU9250_HAL &hal, const WakeOnMotionConfig &config)
+: hal_(hal),
+  config_(config),
+  state_(WomState::IDLE),
+  motionPending_(false),
+  motionAt_us_(0),
+  irqAttached_(false),
+  irqGpio_(0),
+  wokeAt_us_(0),
+  lastMotion_us_(0),
+  lastAccount_us_(0),
+  wakes_(0),
+  sleeps_(0),
+  lastLatency_us_(0),
+  maxLatency_us_(0),
+  totalLatency_us_(0),
+  active_us_(0),
+  cycling_us_(0)
+{ }
+
+void WakeOnMotionEngine::attachInterrupt(uint gpio)
+{
+    gpio_init(gpio);
+    gpio_set_dir(gpio, GPIO_IN);
+
+    irqOwner_    = this;
+    irqGpio_     = gpio;
+    irqAttached_ = true;
+    gpio_set_irq_enabled_with_callback(gpio, GPIO_IRQ_EDGE_RISE, true, &WakeOnMotionEngine::gpioCallback);
+}
+
+void WakeOnMotionEngine::gpioCallback(uint gpio, uint32_t events)
+{
+    if ((irqOwner_ != nullptr) && (gpio == irqOwner_->irqGpio_) && ((events & GPIO_IRQ_EDGE_RISE) != 0))
+    {
+        irqOwner_->notifyMotion(time_us_32());
+    }
+}
+
+void WakeOnMotionEngine::notifyMotion(uint32_t now_us)
+{
+    /* Keep the first edge: latency is measured from it */
+    if (!motionPending_)
+    {
+        motionAt_us_   = now_us;
+        motionPending_ = true;
+    }
+}
+
+bool WakeOnMotionEngine::begin(uint32_t now_us)
+{
+    lastAccount_us_ = now_us;
+    return enterCycling(now_us);
+}
+
+bool WakeOnMotionEngine::enterCycling(uint32_t now_us)
+{
+    /* Cleared before arming: an edge raised while arming wakes us rather than being lost */
+    motionPending_ = false;
+
+    if (!hal_.enterWakeOnMotion(config_.threshold_mg, config_.wakeRate))
+    {
+        state_ = WomState::FAILED;
+        return false;
+    }
+    state_         = WomState::CYCLING;
+    lastMotion_us_ = now_us;
+    return true;
+}
+
+bool WakeOnMotionEngine::poll(uint32_t now_us)
+{
+    account(now_us);
+
+    if (state_ == WomState::CYCLING)
+    {
+        bool     motion = motionPending_;
+        uint32_t at     = motionAt_us_;
+        uint8_t  status;
+
+        if (!irqAttached_ && hal_.readIntStatus(status) && ((status & INT_STATUS::WOM_INT.mask) != 0))
+        {
+            motion = true;
+            at     = now_us;
+        }
+        if (!motion)
+        {
+            return false;
+        }
+        motionPending_ = false;
+
+        /* Full rate first, then release the latched INT line */
+        if (!hal_.exitWakeOnMotion() || !hal_.readIntStatus(status))
+        {
+            state_ = WomState::FAILED;
+            return true;
+        }
+
+        const uint32_t done    = time_us_32();
+        const uint32_t latency = done - at;
+        lastLatency_us_   = latency;
+        totalLatency_us_ += latency;
+        if (latency > maxLatency_us_)
+        {
+            maxLatency_us_ = latency;
+        }
+
+        state_         = WomState::ACTIVE;
+        wokeAt_us_     = done;
+        lastMotion_us_ = done;
+        wakes_++;
+        return true;
+    }
+
+    if (state_ == WomState::ACTIVE)
+    {
+        if ((now_us - lastMotion_us_) < config_.quietPeriod_us)
+        {
+            return false;
+        }
+        if (enterCycling(now_us))
+        {
+            sleeps_++;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+void WakeOnMotionEngine::reportSample(const AccelData &accel, const GyroData &gyro, uint32_t now_us)
+{
+    if (state_ != WomState::ACTIVE)
+    {
+        return;
+    }
+
+    /* The gyro reads garbage while it spins up; judge on the accel alone until then */
+    const float weight = gyroSettled(now_us) ? config_.gyroWeight : 0.0f;
+    if (computeMotionEnergy(accel, gyro, weight) >= config_.quietEnergy)
+    {
+        lastMotion_us_ = now_us;
+    }
+}
+
+bool WakeOnMotionEngine::gyroSettled(uint32_t now_us) const
+{
+    return (state_ == WomState::ACTIVE) && ((now_us - wokeAt_us_) >= WOM_GYRO_SETTLE_US);
+}
+
+uint32_t WakeOnMotionEngine::meanWakeLatency_us() const
+{
+    return (wakes_ == 0) ? 0 : (uint32_t)(totalLatency_us_ / wakes_);
+}
+
+float WakeOnMotionEngine::dutyCycle() const
+{
+    const uint64_t total = active_us_ + cycling_us_;
+    return (total == 0) ? 0.0f : (float)((double)active_us_ / (double)total);
+}
+
+void WakeOnMotionEngine::account(uint32_t now_us)
+{
+    const uint32_t dt_us = now_us - lastAccount_us_;
+    lastAccount_us_ = now_us;
+
+    if (state_ == WomState::ACTIVE)
+    {
+        active_us_ += dt_us;
+    }
+    else if (state_ == WomState::CYCLING)
+    {
+        cycling_us_ += dt_us;
+    }
+}
@@ -0,0 +1,191 @@
+/**
+ * @file  :MPU9250_WakeOnMotion.hpp
+ * @brief :Wake-on-motion event engine for battery operation.
+ *
+ * Battery units only care about motion events, yet a polled, fully awake
+ * MPU9250 draws several mA. The WakeOnMotionEngine parks the sensor in its
+ * accel-only cycle mode (gyro off, wake-on-motion comparator armed) and lets
+ * the INT pin wake the firmware. On the interrupt it restores full-rate
+ * acquisition; once the motion energy has stayed below a quiet level for the
+ * configured period it drops back to cycling.
+ *
+ * The GPIO interrupt only records a timestamp and a flag; all bus traffic
+ * happens in poll(), so wake latency is bounded by the poll interval plus the
+ * exit transaction (five register writes and one 5-byte burst). Transitions,
+ * wake latency and duty cycle are counted for the power budget.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef IMU_WAKE_ON_MOTION_HPP
+#define IMU_WAKE_ON_MOTION_HPP
+
+/****************************************** include part ********************************************* */
+#include "../HAL/MPU9250_HAL.hpp"
+#include "MPU9250_Service.hpp"
+#include <cstdint>
+/**************************************** User Data Types Part *************************************** */
+
+/* Gyro start-up time after leaving cycle mode; its output is ignored until then */
+constexpr uint32_t WOM_GYRO_SETTLE_US = MPU9250_GYRO_SETTLE_US;
+
+/**
+ * @enum  :WomState
+ * @brief :Power state of the wake-on-motion engine.
+ */
+enum class WomState : uint8_t
+{
+    IDLE,     // begin() not called yet
+    CYCLING,  // accel-only low-power cycling, waiting for a motion interrupt
+    ACTIVE,   // full-rate acquisition
+    FAILED    // bus error while switching modes
+};
+
+/**
+ * @struct :WakeOnMotionConfig
+ * @brief  :Wake threshold and quiet-period settings.
+ */
+struct WakeOnMotionConfig
+{
+    uint16_t               threshold_mg;   // WOM comparator threshold (4 mg steps)
+    MPU9250Reg::LpAccelOdr wakeRate;       // accel sample rate while cycling
+    float                  quietEnergy;    // motion energy below which a sample counts as quiet
+    float                  gyroWeight;     // see computeMotionEnergy()
+    uint32_t               quietPeriod_us; // time without motion before returning to cycling
+};
+/****************************************************************************************************** */
+/**
+ * @class :WakeOnMotionEngine
+ * @brief :CYCLING <-> ACTIVE state machine driven by the MPU9250 WOM interrupt.
+ *
+ * Wiring: the MPU9250 INT pin (active high, latched until INT_STATUS is
+ * read) to a GPIO passed to attachInterrupt(). Without a GPIO, poll() reads
+ * INT_STATUS instead, at the cost of one bus read per poll while cycling.
+ * All timestamps are time_us_32() values.
+ */
+class WakeOnMotionEngine
+{
+public:
+    /**
+     * @brief :Constructor for WakeOnMotionEngine.
+     *
+     * @param hal    :HAL used to switch the sensor's power mode.
+     * @param config :Threshold and quiet-period settings.
+     */
+    WakeOnMotionEngine(MPU9250_HAL &hal, const WakeOnMotionConfig &config);
+
+    /**
+     * @brief :Route the rising edge of the INT pin on a GPIO to this engine.
+     *
+     * Uses the SDK's shared GPIO callback, so it replaces any callback
+     * registered before; only one engine can be attached.
+     *
+     * @param gpio :GPIO connected to the MPU9250 INT pin.
+     */
+    void attachInterrupt(uint gpio);
+
+    /**
+     * @brief :Record a motion interrupt. Safe to call from an ISR.
+     *
+     * @param now_us :Interrupt time.
+     */
+    void notifyMotion(uint32_t now_us);
+
+    /**
+     * @brief :Put the sensor into wake-on-motion cycling.
+     *
+     * @param now_us :Current time.
+     * @return :true on success, false on bus error (state FAILED).
+     */
+    bool begin(uint32_t now_us);
+
+    /**
+     * @brief :Service pending interrupts and the quiet timer. Call from the main loop.
+     *
+     * @param now_us :Current time.
+     * @return :true if the state changed.
+     */
+    bool poll(uint32_t now_us);
+
+    /**
+     * @brief :Feed one full-rate sample while ACTIVE to keep the quiet timer honest.
+     *
+     * @param accel  :Accelerometer sample in g.
+     * @param gyro   :Gyroscope sample in dps (ignored until the gyro has settled).
+     * @param now_us :Acquisition time.
+     */
+    void reportSample(const AccelData &accel, const GyroData &gyro, uint32_t now_us);
+
+    /**
+     * @brief :Current state.
+     */
+    WomState state() const { return state_; }
+
+    /**
+     * @brief :true once the gyro output is valid after the last wake.
+     */
+    bool gyroSettled(uint32_t now_us) const;
+
+    /**
+     * @brief :Number of CYCLING -> ACTIVE transitions.
+     */
+    uint32_t wakes() const { return wakes_; }
+
+    /**
+     * @brief :Number of ACTIVE -> CYCLING transitions.
+     */
+    uint32_t sleeps() const { return sleeps_; }
+
+    /**
+     * @brief :Interrupt-to-full-rate latency of the last wake, in microseconds.
+     */
+    uint32_t lastWakeLatency_us() const { return lastLatency_us_; }
+
+    /**
+     * @brief :Worst interrupt-to-full-rate latency so far, in microseconds.
+     */
+    uint32_t maxWakeLatency_us() const { return maxLatency_us_; }
+
+    /**
+     * @brief :Mean interrupt-to-full-rate latency, in microseconds.
+     */
+    uint32_t meanWakeLatency_us() const;
+
+    /**
+     * @brief :Fraction of time spent ACTIVE since begin(), 0..1.
+     */
+    float dutyCycle() const;
+
+private:
+    MPU9250_HAL &hal_;
+    WakeOnMotionConfig config_;
+    WomState state_;
+
+    volatile bool     motionPending_;
+    volatile uint32_t motionAt_us_;
+    bool irqAttached_;
+    uint irqGpio_;
+
+    uint32_t wokeAt_us_;
+    uint32_t lastMotion_us_;
+    uint32_t lastAccount_us_;
+
+    uint32_t wakes_;
+    uint32_t sleeps_;
+    uint32_t lastLatency_us_;
+    uint32_t maxLatency_us_;
+    uint64_t totalLatency_us_;
+    uint64_t active_us_;
+    uint64_t cycling_us_;
+
+    static WakeOnMotionEngine *irqOwner_;
+    static void gpioCallback(uint gpio, uint32_t events);
+
+    void account(uint32_t now_us);
+    bool enterCycling(uint32_t now_us);
+};
+
+#endif // IMU_WAKE_ON_MOTION_HPP
@@ -0,0 +1,91 @@
+/**
+ * @file  :bench_decode.cpp
+ * @brief :Decode throughput in frames per second, per kernel and burst size.
+ *
+ * Built once per instruction-set variant like test_decode. Burst sizes cover
+ * one 512-byte FIFO read (36 six-axis frames), a larger replay buffer and an
+ * odd start address.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Decode.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    typedef void (*DecodeFn)(const uint8_t*, size_t, const FrameColumns&);
+
+    constexpr size_t TARGET_FRAMES = 50000000;
+
+    double framesPerSecond(DecodeFn fn, size_t frameBytes, size_t frames, size_t offset)
+    {
+        std::mt19937 rng(5);
+        std::vector<uint8_t> buffer(offset + frames * frameBytes);
+        for (uint8_t& b : buffer)
+        {
+            b = (uint8_t)rng();
+        }
+        std::vector<int16_t> storage[FRAME_CHANNEL_COUNT];
+        FrameColumns cols;
+        for (uint8_t c = 0; c < FRAME_CHANNEL_COUNT; c++)
+        {
+            storage[c].resize(frames);
+            cols.channel[c] = storage[c].data();
+        }
+
+        const size_t reps = TARGET_FRAMES / frames + 1;
+        double best = 0.0;
+        for (int round = 0; round < 3; round++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t r = 0; r < reps; r++)
+            {
+                fn(buffer.data() + offset, frames, cols);
+                __asm__ __volatile__("" : : "r"(storage[0].data()) : "memory");
+            }
+            const auto stop = std::chrono::steady_clock::now();
+            const double fps = (double)(reps * frames) / std::chrono::duration<double>(stop - start).count();
+            if (fps > best)
+            {
+                best = fps;
+            }
+        }
+        return best;
+    }
+
+    void row(const char* name, DecodeFn fn, DecodeFn fn9)
+    {
+        std::printf("%-8s", name);
+        const size_t sizes[] = { 36, 1024 };
+        for (size_t frames : sizes)
+        {
+            std::printf(" %9.1f", framesPerSecond(fn, MPU9250_FRAME_BYTES, frames, 0) / 1e6);
+        }
+        std::printf(" %9.1f", framesPerSecond(fn, MPU9250_FRAME_BYTES, 1024, 1) / 1e6);
+        std::printf(" %9.1f\n", framesPerSecond(fn9, MPU9250_FRAME9_BYTES, 1024, 0) / 1e6);
+    }
+}
+
+int main()
+{
+#if defined(__AVX2__)
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        std::printf("bench_decode: AVX2 not supported by this CPU\n");
+        return 0;
+    }
+#endif
+
+    std::printf("dispatch kernel: %s, Mframes/s\n", decodeKernelName());
+    std::printf("%-8s %9s %9s %9s %9s\n", "kernel", "6ax x36", "6ax x1024", "odd x1024", "9ax x1024");
+    row("scalar", decodeFramesScalar, decodeFrames9Scalar);
+    row("dispatch", decodeFrames, decodeFrames9);
+    return 0;
+}
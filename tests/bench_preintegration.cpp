@@ -0,0 +1,63 @@
+/**
+ * @file  :bench_preintegration.cpp
+ * @brief :Per-sample cost of Preintegrator::push() on the host.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Preintegration.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+int main()
+{
+    constexpr size_t SAMPLES = 1u << 14;
+    constexpr int    PASSES  = 500;
+
+    std::vector<GyroData>  gyro(SAMPLES);
+    std::vector<AccelData> accel(SAMPLES);
+    for (size_t n = 0; n < SAMPLES; n++)
+    {
+        const float t = n * 0.001f;
+        gyro[n]  = { 30.0f * std::sin(t * 40.0f), 20.0f * std::cos(t * 35.0f), 5.0f };
+        accel[n] = { 0.1f * std::sin(t * 90.0f), 0.05f, 1.0f + 0.2f * std::cos(t * 70.0f) };
+    }
+
+    PreintConfig cfg;
+    cfg.decimation        = 10;
+    cfg.gyroNoiseDensity  = 1.7e-4f;
+    cfg.accelNoiseDensity = 2.9e-3f;
+
+    double best = 1e30;
+    volatile float sink = 0.0f;
+    for (int rep = 0; rep < 3; rep++)
+    {
+        Preintegrator pre(cfg);
+        const auto start = std::chrono::steady_clock::now();
+        for (int p = 0; p < PASSES; p++)
+        {
+            for (size_t n = 0; n < SAMPLES; n++)
+            {
+                if (pre.push(gyro[n], accel[n], 0.001f))
+                {
+                    sink = pre.output().dTheta_rad[0];
+                }
+            }
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / ((double)SAMPLES * PASSES);
+        if (ns < best)
+        {
+            best = ns;
+        }
+    }
+
+    std::printf("Preintegrator::push  %.2f ns/sample (decimation %u)\n", best, (unsigned)cfg.decimation);
+    (void)sink;
+    return 0;
+}
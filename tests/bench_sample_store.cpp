@@ -0,0 +1,128 @@
+/**
+ * @file  :bench_sample_store.cpp
+ * @brief :SampleStore density and deferred-conversion cost.
+ *
+ * Density is the number of buffered samples per KB of SRAM: the whole
+ * SampleStore object (columns, deltas, resync slots, indices) divided by its
+ * capacity, against the buffer the store replaces, an IMUData plus a 32-bit
+ * timestamp per sample. Conversion compares readBatch() on a full store with
+ * converting each sample as it is captured into such an IMUData buffer.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_SampleStore.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr int PASSES = 2000;
+    constexpr uint32_t PERIOD_US = 1000;
+
+    const SampleScale SCALE = { 1.0f / 16384.0f, 1.0f / 131.0f, 1.0f / 333.87f, 21.0f, 0.15f };
+
+    struct TimedSample
+    {
+        IMUData  data;
+        uint32_t timestamp_us;
+    };
+
+    template <typename Body>
+    double nsPerSample(Body body)
+    {
+        double best = 1e30;
+        for (int rep = 0; rep < 3; rep++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int p = 0; p < PASSES; p++)
+            {
+                body();
+            }
+            const auto stop = std::chrono::steady_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / ((double)STORE_CAPACITY * PASSES);
+            if (ns < best)
+            {
+                best = ns;
+            }
+        }
+        return best;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> value(-32768, 32767);
+    std::vector<int16_t> raw(STORE_CAPACITY * FRAME_CHANNEL_COUNT);
+    for (int16_t &v : raw)
+    {
+        v = (int16_t)value(rng);
+    }
+
+    const double storeBytes  = (double)sizeof(SampleStore) / STORE_CAPACITY;
+    const double directBytes = (double)sizeof(TimedSample);
+    std::printf("SampleStore          %6.1f B/sample  %6.1f samples/KB\n", storeBytes, 1024.0 / storeBytes);
+    std::printf("IMUData + timestamp  %6.1f B/sample  %6.1f samples/KB\n", directBytes, 1024.0 / directBytes);
+
+    static SampleStore store;
+    static IMUData     batch[STORE_CAPACITY];
+    static uint32_t    batchTs[STORE_CAPACITY];
+    volatile float sink = 0.0f;
+
+    /* Fill untimed, then time only readBatch() */
+    double deferred = 1e30;
+    for (int rep = 0; rep < 3; rep++)
+    {
+        double total_ns = 0.0;
+        for (int p = 0; p < PASSES; p++)
+        {
+            for (uint32_t n = 0; n < STORE_CAPACITY; n++)
+            {
+                store.push(&raw[n * FRAME_CHANNEL_COUNT], n * PERIOD_US);
+            }
+            const auto start = std::chrono::steady_clock::now();
+            store.readBatch(batch, batchTs, STORE_CAPACITY, SCALE);
+            const auto stop = std::chrono::steady_clock::now();
+            total_ns += std::chrono::duration<double, std::nano>(stop - start).count();
+            sink = batch[p & (STORE_CAPACITY - 1)].gyro.z_dps;
+        }
+        const double ns = total_ns / ((double)STORE_CAPACITY * PASSES);
+        if (ns < deferred)
+        {
+            deferred = ns;
+        }
+    }
+
+    static TimedSample direct[STORE_CAPACITY];
+    const double eager = nsPerSample([&]()
+    {
+        for (uint32_t n = 0; n < STORE_CAPACITY; n++)
+        {
+            const int16_t *ch = &raw[n * FRAME_CHANNEL_COUNT];
+            TimedSample &s = direct[n];
+            s.data.accel.x_g          = ch[FRAME_ACCEL_X] * SCALE.accel;
+            s.data.accel.y_g          = ch[FRAME_ACCEL_Y] * SCALE.accel;
+            s.data.accel.z_g          = ch[FRAME_ACCEL_Z] * SCALE.accel;
+            s.data.gyro.x_dps         = ch[FRAME_GYRO_X] * SCALE.gyro;
+            s.data.gyro.y_dps         = ch[FRAME_GYRO_Y] * SCALE.gyro;
+            s.data.gyro.z_dps         = ch[FRAME_GYRO_Z] * SCALE.gyro;
+            s.data.temp.temperature_c = (ch[FRAME_TEMP] * SCALE.temp) + SCALE.tempOffset;
+            s.data.mag.x_uT           = ch[FRAME_MAG_X] * SCALE.mag;
+            s.data.mag.y_uT           = ch[FRAME_MAG_Y] * SCALE.mag;
+            s.data.mag.z_uT           = ch[FRAME_MAG_Z] * SCALE.mag;
+            s.timestamp_us            = n * PERIOD_US;
+        }
+        sink = direct[STORE_CAPACITY - 1].data.gyro.z_dps;
+    });
+
+    std::printf("readBatch            %7.2f ns/sample\n", deferred);
+    std::printf("convert on capture   %7.2f ns/sample\n", eager);
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file  :bench_telemetry.cpp
+ * @brief :Time to format the main loop's accelerometer line, TelemetryLine vs snprintf vs iostream.
+ *
+ * Host timing only. Flash and RAM footprint against <iostream> has to be
+ * measured on the firmware image and is not covered here.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Telemetry.hpp"
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+    constexpr size_t VALUES = 4096;
+    constexpr int    PASSES = 200;
+
+    template <typename Body>
+    double nsPerLine(Body body)
+    {
+        double best = 1e30;
+        for (int rep = 0; rep < 3; rep++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int p = 0; p < PASSES; p++)
+            {
+                for (size_t i = 0; i + 2 < VALUES; i += 3)
+                {
+                    body(i);
+                }
+            }
+            const auto stop = std::chrono::steady_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / (PASSES * (VALUES / 3));
+            if (ns < best)
+            {
+                best = ns;
+            }
+        }
+        return best;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(-2.0f, 2.0f);
+    std::vector<float> v(VALUES);
+    for (float &x : v)
+    {
+        x = dist(rng);
+    }
+
+    static char buf[96];
+    volatile size_t sink = 0;
+
+    /* Same line as Application/main.cpp: "Acc(g): x   y   z\n" with 4 decimals */
+    const double line = nsPerLine([&](size_t i)
+    {
+        TelemetryLine l(buf, sizeof(buf));
+        l.text("Acc(g): ").fixed(v[i], 4).text("   ").fixed(v[i + 1], 4).text("   ").fixed(v[i + 2], 4).newline();
+        sink = l.length();
+    });
+
+    const double formatted = nsPerLine([&](size_t i)
+    {
+        sink = (size_t)std::snprintf(buf, sizeof(buf), "Acc(g): %.4f   %.4f   %.4f\n", v[i], v[i + 1], v[i + 2]);
+    });
+
+    std::ostringstream os;
+    const double stream = nsPerLine([&](size_t i)
+    {
+        os.str(std::string());
+        os << "Acc(g): " << std::fixed << std::setprecision(4) << v[i] << "   " << v[i + 1] << "   " << v[i + 2] << "\n";
+        sink = os.tellp();
+    });
+
+    std::printf("TelemetryLine  %7.1f ns/line\n", line);
+    std::printf("snprintf       %7.1f ns/line\n", formatted);
+    std::printf("ostringstream  %7.1f ns/line\n", stream);
+    (void)sink;
+    return 0;
+}
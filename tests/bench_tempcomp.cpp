@@ -0,0 +1,144 @@
+/**
+ * @file  :bench_tempcomp.cpp
+ * @brief :Per-sample cost of TempCompensator against plain scaling.
+ *
+ * Replays a synthetic 1 kHz log: the die warms at 1 °C/min and the
+ * temperature reading carries a few LSB of noise (1 LSB = 1/333.87 °C), so
+ * nearly every sample reports a different float temperature. Each variant
+ * converts six raw axes to physical units; the compensated ones call
+ * update() with every sample first.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_TempComp.hpp"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t SAMPLES = 1u << 16;
+    constexpr int    PASSES  = 64;
+
+    constexpr float ACCEL_SCALE = 1.0f / 16384.0f;
+    constexpr float GYRO_SCALE  = 1.0f / 131.0f;
+
+    struct LogSample
+    {
+        int16_t raw[TC_AXIS_COUNT];
+        float   temp_c;
+    };
+
+    std::vector<LogSample> makeLog()
+    {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> tempNoise(-3, 3);
+        std::uniform_int_distribution<int> axisNoise(-20, 20);
+
+        std::vector<LogSample> log(SAMPLES);
+        for (size_t n = 0; n < SAMPLES; n++)
+        {
+            const float drift_c  = 25.0f + (float)n / 60000.0f;           // 1 °C per minute at 1 kHz
+            const int   tempRaw  = (int)((drift_c - 21.0f) * 333.87f) + tempNoise(rng);
+            log[n].temp_c = tempRaw / 333.87f + 21.0f;
+            for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+            {
+                log[n].raw[a] = (int16_t)(((a == TC_ACCEL_Z) ? 16384 : 0) + axisNoise(rng));
+            }
+        }
+        return log;
+    }
+
+    TempBiasTable makeTable()
+    {
+        TempBiasTable t = {};
+        t.tempStart_cC = 0;
+        t.tempStep_cC  = 500;
+        for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+        {
+            for (uint8_t i = 0; i < TEMP_COMP_POINTS; i++)
+            {
+                t.bias[a][i] = (int16_t)((a + 1) * 3 * i - 20);
+            }
+        }
+        return t;
+    }
+
+    template <typename Body>
+    double nsPerSample(const std::vector<LogSample> &log, Body body)
+    {
+        double best = 1e30;
+        for (int rep = 0; rep < 3; rep++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (int p = 0; p < PASSES; p++)
+            {
+                for (const LogSample &s : log)
+                {
+                    body(s);
+                }
+            }
+            const auto stop = std::chrono::steady_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / ((double)SAMPLES * PASSES);
+            if (ns < best)
+            {
+                best = ns;
+            }
+        }
+        return best;
+    }
+}
+
+int main()
+{
+    const std::vector<LogSample> log   = makeLog();
+    const TempBiasTable          table = makeTable();
+    volatile float sink = 0.0f;
+
+    const double plain = nsPerSample(log, [&](const LogSample &s)
+    {
+        float acc = 0.0f;
+        for (uint8_t a = TC_ACCEL_X; a <= TC_ACCEL_Z; a++)
+        {
+            acc += s.raw[a] * ACCEL_SCALE;
+        }
+        for (uint8_t a = TC_GYRO_X; a <= TC_GYRO_Z; a++)
+        {
+            acc += s.raw[a] * GYRO_SCALE;
+        }
+        sink = acc;
+    });
+
+    TempCompensator comp(table);
+    const double compensated = nsPerSample(log, [&](const LogSample &s)
+    {
+        int16_t r[TC_AXIS_COUNT];
+        for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+        {
+            r[a] = s.raw[a];
+        }
+        comp.update(s.temp_c);
+        comp.correctAccel(r[TC_ACCEL_X], r[TC_ACCEL_Y], r[TC_ACCEL_Z]);
+        comp.correctGyro(r[TC_GYRO_X], r[TC_GYRO_Y], r[TC_GYRO_Z]);
+        float acc = 0.0f;
+        for (uint8_t a = TC_ACCEL_X; a <= TC_ACCEL_Z; a++)
+        {
+            acc += r[a] * ACCEL_SCALE;
+        }
+        for (uint8_t a = TC_GYRO_X; a <= TC_GYRO_Z; a++)
+        {
+            acc += r[a] * GYRO_SCALE;
+        }
+        sink = acc;
+    });
+
+    std::printf("plain scaling        %7.2f ns/sample\n", plain);
+    std::printf("compensated + scale  %7.2f ns/sample (+%.2f ns)\n", compensated, compensated - plain);
+    (void)sink;
+    return 0;
+}
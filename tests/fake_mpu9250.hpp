@@ -0,0 +1,229 @@
+/**
+ * @file  :fake_mpu9250.hpp
+ * @brief :Simulated MPU9250 register file for the host tests.
+ *
+ * Answers WHO_AM_I, keeps every written register and logs every write, so
+ * tests can check what the HAL actually put on the bus. On the simulated
+ * clock it models:
+ *  - H_RESET: registers return to their reset values and PWR_MGMT_1 keeps
+ *    the reset bit set for resetTime_us;
+ *  - wake: the output registers read zero until a PWR_MGMT_1 write clears
+ *    SLEEP, then accel/temp after accelStart_us and gyro after gyroStart_us;
+ *  - the wake-on-motion comparator: once armed, an accel change above
+ *    WOM_THR sets INT_STATUS.WOM_INT and raises the INT GPIO, which stays
+ *    high in latched mode until INT_STATUS is read.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef FAKE_MPU9250_HPP
+#define FAKE_MPU9250_HPP
+
+/****************************************** include part ********************************************* */
+#include "host_shim.hpp"
+#include "hardware/gpio.h"
+#include "MPU9250_HAL.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+/****************************************************************************************************** */
+
+class FakeMpu9250 : public HostShim::RegisterDevice
+{
+public:
+    /**
+     * @param intGpio :GPIO the INT pin is wired to.
+     */
+    explicit FakeMpu9250(uint intGpio = 0)
+    : resetTime_us(11000),
+      accelStart_us(20000),
+      gyroStart_us(MPU9250_GYRO_SETTLE_US),
+      accel{ 120, -340, 16384 },
+      gyro{ 7, -12, 3 },
+      temp(1500),
+      intGpio_(intGpio),
+      intHigh_(false),
+      resetting_(false),
+      awake_(false),
+      resetDone_us_(0),
+      wakeAt_us_(0)
+    {
+        powerOn();
+        for (uint32_t &w : writes_)
+        {
+            w = 0;
+        }
+        for (uint8_t &w : written_)
+        {
+            w = 0;
+        }
+    }
+
+    uint32_t resetTime_us;   // H_RESET to register access
+    uint32_t accelStart_us;  // wake to first accel/temp conversion
+    uint32_t gyroStart_us;   // wake to first gyro conversion
+    int16_t  accel[3];       // output register values once converting
+    int16_t  gyro[3];
+    int16_t  temp;
+
+    /* Number of times reg was written since construction */
+    uint32_t writes(uint8_t reg) const { return writes_[reg]; }
+
+    /* Every (register, value) written since construction, in bus order */
+    const std::vector<std::pair<uint8_t, uint8_t>> &writeLog() const { return log_; }
+
+    /* OR of every value written to reg since construction */
+    uint8_t bitsWritten(uint8_t reg) const { return written_[reg]; }
+
+    /* Cycle mode with the gyro off and the WOM comparator and interrupt enabled */
+    bool womArmed() const
+    {
+        using namespace MPU9250Reg;
+        return ((regs[PWR_MGMT_1::address] & PWR_MGMT_1::CYCLE.mask) != 0) &&
+               (regs[PWR_MGMT_2::address] == 0x07) &&
+               ((regs[INT_ENABLE::address] & INT_ENABLE::WOM_EN.mask) != 0) &&
+               (regs[MOT_DETECT_CTRL::address] == 0xC0);
+    }
+
+    /* Level of the INT pin (latched mode only; a pulse is not held) */
+    bool intHigh() const { return intHigh_; }
+
+    /**
+     * @brief :Apply an accel change between two wake samples.
+     *
+     * @param delta_mg :Largest per-axis change in mg.
+     * @return :true if the comparator fired and the INT GPIO got a rising edge.
+     */
+    bool motion(uint16_t delta_mg)
+    {
+        using namespace MPU9250Reg;
+        if (!womArmed() || (delta_mg <= regs[WOM_THR::address] * 4u))
+        {
+            return false;
+        }
+        regs[INT_STATUS::address] |= INT_STATUS::WOM_INT.mask;
+        if (intHigh_)
+        {
+            return false;
+        }
+        intHigh_ = (regs[INT_PIN_CFG::address] & INT_PIN_CFG::LATCH_INT_EN.mask) != 0;
+        HostShim::raiseGpioIrq(intGpio_, GPIO_IRQ_EDGE_RISE);
+        return true;
+    }
+
+protected:
+    void onWrite(uint8_t reg, uint8_t value) override
+    {
+        using namespace MPU9250Reg;
+        writes_[reg]++;
+        written_[reg] |= value;
+        log_.emplace_back(reg, value);
+        advance();
+        if (resetting_)
+        {
+            return;  // the register file is not accessible until the reset completes
+        }
+        regs[reg] = value;
+
+        if (reg == PWR_MGMT_1::address)
+        {
+            if ((value & PWR_MGMT_1::H_RESET.mask) != 0)
+            {
+                powerOn();
+                regs[reg]     = value;
+                resetting_    = true;
+                resetDone_us_ = time_us_32() + resetTime_us;
+            }
+            else if ((value & PWR_MGMT_1::SLEEP.mask) != 0)
+            {
+                awake_ = false;
+            }
+            else if (!awake_)
+            {
+                awake_     = true;
+                wakeAt_us_ = time_us_32();
+            }
+        }
+    }
+
+    uint8_t onRead(uint8_t reg) override
+    {
+        using namespace MPU9250Reg;
+        advance();
+        if ((reg >= ACCEL_XOUT_H::address) && (reg <= GYRO_ZOUT_L::address))
+        {
+            return outputByte(reg);
+        }
+
+        const uint8_t value = regs[reg];
+        if (reg == MPU9250Reg::INT_STATUS::address)
+        {
+            /* Read-to-clear, releases a latched INT pin */
+            regs[reg] = 0;
+            intHigh_  = false;
+        }
+        return value;
+    }
+
+private:
+    uint     intGpio_;
+    bool     intHigh_;
+    bool     resetting_;
+    bool     awake_;
+    uint32_t resetDone_us_;
+    uint32_t wakeAt_us_;
+    std::vector<std::pair<uint8_t, uint8_t>> log_;
+    uint32_t writes_[256];
+    uint8_t  written_[256];
+
+    /* Register reset values: 0x00 except PWR_MGMT_1 and WHO_AM_I */
+    void powerOn()
+    {
+        for (uint8_t &r : regs)
+        {
+            r = 0;
+        }
+        regs[MPU9250Reg::PWR_MGMT_1::address] = 0x01;
+        regs[MPU9250Reg::WHO_AM_I::address]   = MPU9250Reg::WHO_AM_I_MPU9250;
+        awake_ = false;
+    }
+
+    void advance()
+    {
+        if (resetting_ && ((int32_t)(time_us_32() - resetDone_us_) >= 0))
+        {
+            resetting_ = false;
+            regs[MPU9250Reg::PWR_MGMT_1::address] = 0x01;
+        }
+    }
+
+    /* ACCEL_XOUT_H .. GYRO_ZOUT_L, big-endian, zero until the sensor converts */
+    uint8_t outputByte(uint8_t reg) const
+    {
+        const uint8_t  offset  = reg - MPU9250Reg::ACCEL_XOUT_H::address;
+        const uint32_t awake   = time_us_32() - wakeAt_us_;
+        const bool     gyroOn  = awake_ && !resetting_ && (awake >= gyroStart_us);
+        const bool     accelOn = awake_ && !resetting_ && (awake >= accelStart_us);
+
+        int16_t value;
+        if (offset < 6)
+        {
+            value = accelOn ? accel[offset / 2] : 0;
+        }
+        else if (offset < 8)
+        {
+            value = accelOn ? temp : 0;
+        }
+        else
+        {
+            value = gyroOn ? gyro[(offset - 8) / 2] : 0;
+        }
+        const uint16_t bits = (uint16_t)value;
+        return ((offset & 1) == 0) ? (uint8_t)(bits >> 8) : (uint8_t)(bits & 0xFF);
+    }
+};
+
+#endif // FAKE_MPU9250_HPP
@@ -0,0 +1,48 @@
+/**
+ * @file  :gpio.h
+ * @brief :Host stand-in for the Pico SDK hardware/gpio.h used by the unit tests.
+ *
+ * The registered IRQ callback is kept so tests can raise edges through
+ * HostShim::raiseGpioIrq().
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef HOST_SHIM_HARDWARE_GPIO_H
+#define HOST_SHIM_HARDWARE_GPIO_H
+
+#include <cstdint>
+
+typedef unsigned int uint;
+
+enum gpio_function_t
+{
+    GPIO_FUNC_UART = 2,
+    GPIO_FUNC_I2C  = 3,
+    GPIO_FUNC_SIO  = 5
+};
+
+enum gpio_irq_level
+{
+    GPIO_IRQ_LEVEL_LOW  = 0x1u,
+    GPIO_IRQ_LEVEL_HIGH = 0x2u,
+    GPIO_IRQ_EDGE_FALL  = 0x4u,
+    GPIO_IRQ_EDGE_RISE  = 0x8u
+};
+
+#define GPIO_OUT true
+#define GPIO_IN  false
+
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_set_function(uint gpio, gpio_function_t fn);
+void gpio_pull_up(uint gpio);
+void gpio_pull_down(uint gpio);
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback);
+
+#endif // HOST_SHIM_HARDWARE_GPIO_H
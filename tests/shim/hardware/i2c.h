@@ -0,0 +1,32 @@
+/**
+ * @file  :i2c.h
+ * @brief :Host stand-in for the Pico SDK hardware/i2c.h used by the unit tests.
+ *
+ * Transfers are routed to the HostShim::I2cDevice attached at the target
+ * address; a missing device NACKs like on the real bus.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef HOST_SHIM_HARDWARE_I2C_H
+#define HOST_SHIM_HARDWARE_I2C_H
+
+#include "pico/stdlib.h"
+
+#define PICO_ERROR_GENERIC (-1)
+
+struct i2c_inst { int index; };
+typedef struct i2c_inst i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst;
+#define i2c0        (&i2c0_inst)
+#define i2c_default i2c0
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+int  i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+int  i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop);
+
+#endif // HOST_SHIM_HARDWARE_I2C_H
@@ -0,0 +1,29 @@
+/**
+ * @file  :systick.h
+ * @brief :Host stand-in for the Pico SDK SysTick register block.
+ *
+ * A plain struct, so cycle measurements read back as zero on the host.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef HOST_SHIM_HARDWARE_STRUCTS_SYSTICK_H
+#define HOST_SHIM_HARDWARE_STRUCTS_SYSTICK_H
+
+#include <cstdint>
+
+typedef struct
+{
+    volatile uint32_t csr;
+    volatile uint32_t rvr;
+    volatile uint32_t cvr;
+    volatile uint32_t calib;
+} systick_hw_t;
+
+extern systick_hw_t host_systick;
+#define systick_hw (&host_systick)
+
+#endif // HOST_SHIM_HARDWARE_STRUCTS_SYSTICK_H
@@ -0,0 +1,32 @@
+/**
+ * @file  :uart.h
+ * @brief :Host stand-in for the Pico SDK hardware/uart.h used by the unit tests.
+ *
+ * Bytes written with uart_putc_raw() are collected and can be read back
+ * through HostShim::uartOutput().
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef HOST_SHIM_HARDWARE_UART_H
+#define HOST_SHIM_HARDWARE_UART_H
+
+#include <cstdint>
+
+typedef unsigned int uint;
+
+struct uart_inst { int index; };
+typedef struct uart_inst uart_inst_t;
+
+extern uart_inst_t uart0_inst;
+#define uart0        (&uart0_inst)
+#define uart_default uart0
+
+uint uart_init(uart_inst_t *uart, uint baudrate);
+bool uart_is_writable(uart_inst_t *uart);
+void uart_putc_raw(uart_inst_t *uart, char c);
+
+#endif // HOST_SHIM_HARDWARE_UART_H
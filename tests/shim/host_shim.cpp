@@ -0,0 +1,195 @@
+#include "host_shim.hpp"
+#include "hardware/gpio.h"
+#include "hardware/uart.h"
+#include "hardware/structs/systick.h"
+#include <cstring>
+
+i2c_inst_t   i2c0_inst  = { 0 };
+uart_inst_t  uart0_inst = { 0 };
+systick_hw_t host_systick = { 0, 0, 0, 0 };
+
+namespace
+{
+    uint64_t                 clock_us = 0;
+    HostShim::I2cDevice     *devices[128] = {};
+    uint32_t                 transfers = 0;
+    gpio_irq_callback_t      gpioCallback = nullptr;
+    std::string              uartBytes;
+}
+
+/* ************************************** HostShim **************************************** */
+
+namespace HostShim
+{
+    RegisterDevice::RegisterDevice()
+    : pointer(0)
+    {
+        std::memset(regs, 0, sizeof(regs));
+    }
+
+    bool RegisterDevice::write(const uint8_t *src, size_t len)
+    {
+        if (len == 0)
+        {
+            return true;
+        }
+        pointer = src[0];
+        for (size_t i = 1; i < len; i++)
+        {
+            onWrite(pointer++, src[i]);
+        }
+        return true;
+    }
+
+    bool RegisterDevice::read(uint8_t *dst, size_t len)
+    {
+        for (size_t i = 0; i < len; i++)
+        {
+            dst[i] = onRead(pointer++);
+        }
+        return true;
+    }
+
+    void RegisterDevice::onWrite(uint8_t reg, uint8_t value)
+    {
+        regs[reg] = value;
+    }
+
+    uint8_t RegisterDevice::onRead(uint8_t reg)
+    {
+        return regs[reg];
+    }
+
+    void reset()
+    {
+        clock_us     = 0;
+        transfers    = 0;
+        gpioCallback = nullptr;
+        uartBytes.clear();
+        for (auto &d : devices)
+        {
+            d = nullptr;
+        }
+    }
+
+    void attach(uint8_t address, I2cDevice *device)
+    {
+        devices[address & 0x7F] = device;
+    }
+
+    void setTime_us(uint64_t now_us)
+    {
+        clock_us = now_us;
+    }
+
+    void advance_us(uint64_t us)
+    {
+        clock_us += us;
+    }
+
+    uint32_t i2cTransfers()
+    {
+        return transfers;
+    }
+
+    void raiseGpioIrq(uint gpio, uint32_t events)
+    {
+        if (gpioCallback != nullptr)
+        {
+            gpioCallback(gpio, events);
+        }
+    }
+
+    const std::string &uartOutput()
+    {
+        return uartBytes;
+    }
+}
+
+/* ************************************** pico/stdlib **************************************** */
+
+uint64_t time_us_64()
+{
+    return clock_us;
+}
+
+uint32_t time_us_32()
+{
+    return (uint32_t)clock_us;
+}
+
+void sleep_us(uint64_t us)
+{
+    clock_us += us;
+}
+
+void sleep_ms(uint32_t ms)
+{
+    clock_us += (uint64_t)ms * 1000u;
+}
+
+bool stdio_init_all()
+{
+    return true;
+}
+
+/* ************************************** hardware/i2c **************************************** */
+
+uint i2c_init(i2c_inst_t *, uint baudrate)
+{
+    return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *, uint8_t addr, const uint8_t *src, size_t len, bool)
+{
+    transfers++;
+    clock_us += (len + 1) * HostShim::I2C_BYTE_US;
+    HostShim::I2cDevice *dev = devices[addr & 0x7F];
+    if ((dev == nullptr) || !dev->write(src, len))
+    {
+        return PICO_ERROR_GENERIC;
+    }
+    return (int)len;
+}
+
+int i2c_read_blocking(i2c_inst_t *, uint8_t addr, uint8_t *dst, size_t len, bool)
+{
+    transfers++;
+    clock_us += (len + 1) * HostShim::I2C_BYTE_US;
+    HostShim::I2cDevice *dev = devices[addr & 0x7F];
+    if ((dev == nullptr) || !dev->read(dst, len))
+    {
+        return PICO_ERROR_GENERIC;
+    }
+    return (int)len;
+}
+
+/* ************************************** hardware/gpio **************************************** */
+
+void gpio_init(uint) { }
+void gpio_set_dir(uint, bool) { }
+void gpio_set_function(uint, gpio_function_t) { }
+void gpio_pull_up(uint) { }
+void gpio_pull_down(uint) { }
+
+void gpio_set_irq_enabled_with_callback(uint, uint32_t, bool enabled, gpio_irq_callback_t callback)
+{
+    gpioCallback = enabled ? callback : nullptr;
+}
+
+/* ************************************** hardware/uart **************************************** */
+
+uint uart_init(uart_inst_t *, uint baudrate)
+{
+    return baudrate;
+}
+
+bool uart_is_writable(uart_inst_t *)
+{
+    return true;
+}
+
+void uart_putc_raw(uart_inst_t *, char c)
+{
+    uartBytes.push_back(c);
+}
@@ -0,0 +1,86 @@
+/**
+ * @file  :host_shim.hpp
+ * @brief :Control surface of the host SDK shims: simulated clock, I2C devices, GPIO IRQs.
+ *
+ * The shims in this directory replace the Pico SDK headers so the HAL and
+ * Services compile and run on the build machine. Tests attach fake I2C
+ * devices, move the clock and raise GPIO interrupts through this header.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef HOST_SHIM_HPP
+#define HOST_SHIM_HPP
+
+/****************************************** include part ********************************************* */
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+/****************************************************************************************************** */
+
+namespace HostShim
+{
+    /* Simulated bus time per transferred byte (9 clocks at 400 kHz) */
+    constexpr uint32_t I2C_BYTE_US = 23;
+
+    /**
+     * @class :I2cDevice
+     * @brief :A target on the simulated I2C bus.
+     */
+    class I2cDevice
+    {
+    public:
+        virtual ~I2cDevice() = default;
+
+        /* Return false to NACK the transfer */
+        virtual bool write(const uint8_t *src, size_t len) = 0;
+        virtual bool read(uint8_t *dst, size_t len) = 0;
+    };
+
+    /**
+     * @class :RegisterDevice
+     * @brief :Register file with an auto-incrementing pointer, like the MPU9250.
+     *
+     * The first byte of a write sets the pointer, the rest are stored from
+     * there; reads return consecutive registers. Override onWrite()/onRead()
+     * to model side effects.
+     */
+    class RegisterDevice : public I2cDevice
+    {
+    public:
+        RegisterDevice();
+
+        bool write(const uint8_t *src, size_t len) override;
+        bool read(uint8_t *dst, size_t len) override;
+
+        uint8_t regs[256];
+        uint8_t pointer;
+
+    protected:
+        virtual void    onWrite(uint8_t reg, uint8_t value);
+        virtual uint8_t onRead(uint8_t reg);
+    };
+
+    /* Put everything back to power-on: clock 0, no devices, no IRQ callback, empty UART */
+    void reset();
+
+    void attach(uint8_t address, I2cDevice *device);
+
+    void     setTime_us(uint64_t now_us);
+    void     advance_us(uint64_t us);
+
+    /* Number of I2C transfers since reset() */
+    uint32_t i2cTransfers();
+
+    /* Call the registered GPIO callback, as the IRQ handler would */
+    void raiseGpioIrq(uint gpio, uint32_t events);
+
+    const std::string &uartOutput();
+}
+
+#endif // HOST_SHIM_HPP
@@ -0,0 +1,43 @@
+/**
+ * @file  :stdlib.h
+ * @brief :Host stand-in for the Pico SDK pico/stdlib.h used by the unit tests.
+ *
+ * Only the subset the driver uses. Time comes from a simulated clock that
+ * the tests control through host_shim.hpp; sleeps advance that clock.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef HOST_SHIM_PICO_STDLIB_H
+#define HOST_SHIM_PICO_STDLIB_H
+
+#include <cstdint>
+#include <cstddef>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+#define PICO_DEFAULT_I2C_SDA_PIN  4
+#define PICO_DEFAULT_I2C_SCL_PIN  5
+#define PICO_DEFAULT_UART_TX_PIN  0
+#define PICO_DEFAULT_UART_RX_PIN  1
+
+uint64_t time_us_64();
+uint32_t time_us_32();
+void     sleep_us(uint64_t us);
+void     sleep_ms(uint32_t ms);
+bool     stdio_init_all();
+
+inline absolute_time_t get_absolute_time() { return time_us_64(); }
+inline absolute_time_t make_timeout_time_ms(uint32_t ms) { return time_us_64() + (uint64_t)ms * 1000u; }
+inline bool time_reached(absolute_time_t t) { return time_us_64() >= t; }
+inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) { return (int64_t)(to - from); }
+inline void tight_loop_contents() { }
+
+#include "hardware/gpio.h"
+#include "hardware/uart.h"
+
+#endif // HOST_SHIM_PICO_STDLIB_H
@@ -0,0 +1,297 @@
+/**
+ * @file  :test_adaptive_rate.cpp
+ * @brief :AdaptiveRateController over simulated motion profiles and tier-table validation.
+ *
+ * A rest / walking / shaking / rest profile is sampled at whatever rate the
+ * controller currently selects, on the simulated clock. The fake MPU9250's
+ * SMPLRT_DIV and CONFIG registers must always match the active tier.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_AdaptiveRate.hpp"
+#include "fake_mpu9250.hpp"
+#include "test_common.hpp"
+#include <cmath>
+#include <random>
+
+using MPU9250Reg::AccelDlpf;
+using MPU9250Reg::GyroDlpf;
+
+namespace
+{
+    constexpr double PI = 3.14159265358979323846;
+
+    enum class Motion
+    {
+        REST,
+        WALK,
+        SHAKE
+    };
+
+    AdaptiveRateConfig makeConfig()
+    {
+        AdaptiveRateConfig cfg = {};
+        cfg.tierCount   = 3;
+        cfg.tiers[0]    = { 19, GyroDlpf::BW_20HZ,  AccelDlpf::BW_21HZ,  0.0f };   //   50 Hz
+        cfg.tiers[1]    = { 4,  GyroDlpf::BW_92HZ,  AccelDlpf::BW_99HZ,  0.05f };  //  200 Hz
+        cfg.tiers[2]    = { 0,  GyroDlpf::BW_184HZ, AccelDlpf::BW_218HZ, 0.5f };   // 1000 Hz
+        cfg.exitRatio   = 0.5f;
+        cfg.holdSamples = 20;
+        cfg.gyroWeight  = 1e-5f;
+        return cfg;
+    }
+
+    void sample(Motion m, double t, std::mt19937 &rng, AccelData &a, GyroData &g)
+    {
+        std::normal_distribution<float> noise(0.0f, 0.002f);
+        a = { noise(rng), noise(rng), 1.0f + noise(rng) };
+        g = { noise(rng) * 100.0f, noise(rng) * 100.0f, noise(rng) * 100.0f };
+        if (m == Motion::WALK)
+        {
+            /* 2 Hz steps: 0.1 g vertical bounce, 30 dps sway */
+            a.z_g += 0.1f * (float)std::sin(2.0 * PI * 2.0 * t);
+            g.y_dps += 30.0f * (float)std::cos(2.0 * PI * 2.0 * t);
+        }
+        else if (m == Motion::SHAKE)
+        {
+            a.x_g += 1.5f * (float)std::sin(2.0 * PI * 8.0 * t);
+            g.z_dps += 300.0f * (float)std::sin(2.0 * PI * 8.0 * t + 0.5);
+        }
+    }
+
+    struct PhaseResult
+    {
+        uint8_t  maxTier;
+        uint8_t  endTier;
+        uint32_t samplesToFirstSwitch;  // 0 if no switch
+        uint32_t switches;
+    };
+
+    bool registersMatch(const FakeMpu9250 &dev, const RateTier &tier)
+    {
+        return (dev.regs[MPU9250Reg::SMPLRT_DIV::address] == tier.divider) &&
+               ((dev.regs[MPU9250Reg::CONFIG::address] & 0x07) == (uint8_t)tier.gyroDlpf) &&
+               ((dev.regs[MPU9250Reg::ACCEL_CONFIG2::address] & 0x07) == (uint8_t)tier.accelDlpf);
+    }
+
+    PhaseResult runPhase(AdaptiveRateController &ctl, const FakeMpu9250 &dev, const AdaptiveRateConfig &cfg,
+                         Motion m, uint32_t duration_us, uint64_t &now_us, std::mt19937 &rng)
+    {
+        PhaseResult r = { ctl.tier(), ctl.tier(), 0, 0 };
+        const uint64_t end = now_us + duration_us;
+        uint32_t n = 0;
+        while (now_us < end)
+        {
+            now_us += ctl.samplePeriod_us();
+            HostShim::setTime_us(now_us);
+            n++;
+
+            AccelData a;
+            GyroData  g;
+            sample(m, now_us * 1e-6, rng, a, g);
+            if (ctl.update(a, g, (uint32_t)now_us))
+            {
+                r.switches++;
+                if (r.samplesToFirstSwitch == 0)
+                {
+                    r.samplesToFirstSwitch = n;
+                }
+            }
+            if (ctl.tier() > r.maxTier)
+            {
+                r.maxTier = ctl.tier();
+            }
+            CHECK(registersMatch(dev, cfg.tiers[ctl.tier()]));
+        }
+        r.endTier = ctl.tier();
+        return r;
+    }
+
+    void testMotionProfile()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+
+        const AdaptiveRateConfig cfg = makeConfig();
+        AdaptiveRateController ctl(hal, cfg);
+        CHECK(ctl.configValid());
+
+        uint64_t now_us = 1000;
+        CHECK(ctl.begin((uint32_t)now_us));
+        CHECK(ctl.tier() == 0);
+        CHECK(ctl.samplePeriod_us() == 20000);
+        CHECK(registersMatch(dev, cfg.tiers[0]));
+
+        std::mt19937 rng(42);
+
+        const PhaseResult rest = runPhase(ctl, dev, cfg, Motion::REST, 5000000, now_us, rng);
+        CHECK(rest.switches == 0);
+        CHECK(rest.endTier == 0);
+
+        const PhaseResult walk = runPhase(ctl, dev, cfg, Motion::WALK, 5000000, now_us, rng);
+        CHECK(walk.maxTier == 1);
+        CHECK(walk.endTier == 1);
+        CHECK(walk.switches == 1);  // hold period rides through the zero crossings of the gait
+
+        const PhaseResult shake = runPhase(ctl, dev, cfg, Motion::SHAKE, 2000000, now_us, rng);
+        CHECK(shake.maxTier == 2);
+        CHECK(shake.endTier == 2);
+        CHECK((shake.samplesToFirstSwitch >= 1) && (shake.samplesToFirstSwitch <= 20));
+        CHECK(ctl.samplePeriod_us() == 1000);
+
+        /* Back to rest: one tier at a time, each after holdSamples quiet samples */
+        const PhaseResult calm = runPhase(ctl, dev, cfg, Motion::REST, 5000000, now_us, rng);
+        CHECK(calm.switches == 2);
+        CHECK(calm.endTier == 0);
+        CHECK(calm.samplesToFirstSwitch == cfg.holdSamples);
+
+        uint64_t total = 0;
+        for (uint8_t t = 0; t < cfg.tierCount; t++)
+        {
+            total += ctl.timeInTier_us(t);
+        }
+        CHECK(total == now_us - 1000);
+        CHECK(ctl.timeInTier_us(3) == 0);
+
+        /* Reads the 1 kHz tier would have issued, minus reads + rate writes issued */
+        const uint32_t fullRate = (uint32_t)(total / 1000);
+        const uint32_t saved    = ctl.transactionsSaved();
+        CHECK((saved > fullRate / 2) && (saved < fullRate));
+        std::printf("profile: %u switches, time in tiers %.1f / %.1f / %.1f s, %u of %u transactions saved\n",
+                    ctl.switches(), ctl.timeInTier_us(0) * 1e-6, ctl.timeInTier_us(1) * 1e-6,
+                    ctl.timeInTier_us(2) * 1e-6, saved, fullRate);
+    }
+
+    /* Two tiers with identical register settings: stepping between them writes nothing */
+    void testUnchangedTierNotCounted()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+
+        AdaptiveRateConfig cfg = makeConfig();
+        cfg.tiers[0] = { 9, GyroDlpf::BW_41HZ, AccelDlpf::BW_45HZ, 0.0f };   // 100 Hz
+        cfg.tiers[1] = { 4, GyroDlpf::BW_41HZ, AccelDlpf::BW_45HZ, 0.05f };  // 200 Hz
+        cfg.tiers[2] = { 4, GyroDlpf::BW_41HZ, AccelDlpf::BW_45HZ, 5.0f };   // 200 Hz, same registers
+        AdaptiveRateController ctl(hal, cfg);
+        CHECK(ctl.configValid());
+
+        uint32_t now_us  = 0;
+        uint32_t updates = 0;
+        uint32_t writes  = 0;
+        const AccelData level = { 0.0f, 0.0f, 1.0f };
+        const GyroData  still = { 0.0f, 0.0f, 0.0f };
+        const GyroData  turn  = { 100.0f, 0.0f, 0.0f };    // energy 0.1
+        const GyroData  spin  = { 1000.0f, 0.0f, 0.0f };   // energy 10
+
+        uint32_t before = HostShim::i2cTransfers();
+        CHECK(ctl.begin(now_us));
+        writes += (HostShim::i2cTransfers() != before) ? 1u : 0u;
+
+        for (int i = 0; i < 50; i++)
+        {
+            now_us += ctl.samplePeriod_us();
+            CHECK(!ctl.update(level, still, now_us));
+            updates++;
+        }
+
+        now_us += ctl.samplePeriod_us();
+        before = HostShim::i2cTransfers();
+        CHECK(ctl.update(level, turn, now_us));
+        updates++;
+        CHECK(ctl.tier() == 1);
+        CHECK(HostShim::i2cTransfers() != before);
+        writes++;
+
+        now_us += ctl.samplePeriod_us();
+        before = HostShim::i2cTransfers();
+        CHECK(ctl.update(level, spin, now_us));
+        updates++;
+        CHECK(ctl.tier() == 2);
+        CHECK(ctl.switches() == 2);
+        CHECK(HostShim::i2cTransfers() == before);  // shadow already matched
+        CHECK(registersMatch(dev, cfg.tiers[2]));
+
+        /* Same arithmetic as transactionsSaved(): only issued reads and writes count */
+        const double fullRateReads = (double)now_us * 1e-6 * (1000.0f / (1.0f + cfg.tiers[2].divider));
+        const double expected      = fullRateReads - (double)(updates + writes);
+        CHECK(expected > 0.0);
+        CHECK(ctl.transactionsSaved() == (uint32_t)expected);
+    }
+
+    void expectRejected(const AdaptiveRateConfig &cfg, const char *why)
+    {
+        HostShim::reset();
+        FakeMpu9250 dev;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+
+        AdaptiveRateController ctl(hal, cfg);
+        const uint32_t before = HostShim::i2cTransfers();
+        const bool valid = ctl.configValid();
+        const bool began = ctl.begin(0);
+
+        AccelData a = { 2.0f, 0.0f, 0.0f };
+        GyroData  g = { 500.0f, 0.0f, 0.0f };
+        const bool switched = ctl.update(a, g, 1000);
+
+        if (valid || began || switched || (HostShim::i2cTransfers() != before))
+        {
+            std::fprintf(stderr, "tier table not rejected: %s\n", why);
+        }
+        CHECK(!valid);
+        CHECK(!began);
+        CHECK(!switched);
+        CHECK(HostShim::i2cTransfers() == before);
+    }
+
+    void testRejectedTables()
+    {
+        AdaptiveRateConfig cfg = makeConfig();
+        cfg.tiers[2].gyroDlpf = GyroDlpf::BW_250HZ;
+        expectRejected(cfg, "DLPF_CFG 0 runs at 8 kHz");
+
+        cfg = makeConfig();
+        cfg.tiers[0].gyroDlpf = GyroDlpf::BW_3600HZ;
+        expectRejected(cfg, "DLPF_CFG 7 runs at 8 kHz");
+
+        cfg = makeConfig();
+        cfg.tiers[2].enterEnergy = 0.04f;
+        expectRejected(cfg, "enterEnergy falls");
+
+        cfg = makeConfig();
+        cfg.tiers[2].enterEnergy = cfg.tiers[1].enterEnergy;
+        expectRejected(cfg, "enterEnergy repeats");
+
+        cfg = makeConfig();
+        cfg.tiers[1].divider = 49;
+        expectRejected(cfg, "rate falls");
+
+        /* tiers[0].enterEnergy is unused and may be anything */
+        cfg = makeConfig();
+        cfg.tiers[0].enterEnergy = 10.0f;
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        AdaptiveRateController ok(hal, cfg);
+        CHECK(ok.configValid());
+    }
+}
+
+int main()
+{
+    testMotionProfile();
+    testUnchangedTierNotCounted();
+    testRejectedTables();
+    return testResult("test_adaptive_rate");
+}
@@ -0,0 +1,63 @@
+/**
+ * @file  :test_common.hpp
+ * @brief :Minimal check macros shared by the host unit tests.
+ *
+ * Each test is a plain executable registered with CTest: failed checks are
+ * printed with their location and the process exits non-zero.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#ifndef TEST_COMMON_HPP
+#define TEST_COMMON_HPP
+
+/****************************************** include part ********************************************* */
+#include <cmath>
+#include <cstdio>
+/****************************************************************************************************** */
+
+inline int &testFailures()
+{
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(cond)                                                                     \
+    do                                                                                  \
+    {                                                                                   \
+        if (!(cond))                                                                    \
+        {                                                                               \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            testFailures()++;                                                           \
+        }                                                                               \
+    } while (0)
+
+#define CHECK_NEAR(a, b, tol)                                                           \
+    do                                                                                  \
+    {                                                                                   \
+        const double va_ = (double)(a);                                                 \
+        const double vb_ = (double)(b);                                                 \
+        if (!(std::fabs(va_ - vb_) <= (double)(tol)))                                   \
+        {                                                                               \
+            std::fprintf(stderr, "%s:%d: CHECK_NEAR failed: %s = %.9g, %s = %.9g, tol %.3g\n", \
+                         __FILE__, __LINE__, #a, va_, #b, vb_, (double)(tol));          \
+            testFailures()++;                                                           \
+        }                                                                               \
+    } while (0)
+
+/* Print the verdict and turn it into the process exit code */
+inline int testResult(const char *name)
+{
+    if (testFailures() == 0)
+    {
+        std::printf("%s: all checks passed\n", name);
+        return 0;
+    }
+    std::printf("%s: %d check(s) failed\n", name, testFailures());
+    return 1;
+}
+
+#endif // TEST_COMMON_HPP
@@ -0,0 +1,170 @@
+/**
+ * @file  :test_decode.cpp
+ * @brief :Every compiled decode kernel against the scalar reference.
+ *
+ * Built once per instruction-set variant (see CMakeLists.txt), each build
+ * compiling MPU9250_Decode.cpp with its own flags. Random frames are decoded
+ * for 0..199 frames, from source buffers at every offset modulo 4 and into
+ * unaligned destination columns. The source ends exactly at the last frame,
+ * so an over-read shows up under MPU9250_SANITIZE; canaries catch writes past
+ * the last frame.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Decode.hpp"
+#include "test_common.hpp"
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t  MAX_FRAMES = 200;
+    constexpr int16_t CANARY     = 0x5A5A;
+
+    typedef void (*DecodeFn)(const uint8_t*, size_t, const FrameColumns&);
+
+    struct Kernel
+    {
+        const char* name;
+        DecodeFn    decode;
+        DecodeFn    decode9;
+    };
+
+    /* Columns with one leading and a few trailing canaries; data starts at an odd int16 offset */
+    struct Columns
+    {
+        std::vector<int16_t> storage[FRAME_CHANNEL_COUNT];
+        FrameColumns         cols;
+
+        explicit Columns(size_t frames)
+        {
+            for (uint8_t c = 0; c < FRAME_CHANNEL_COUNT; c++)
+            {
+                storage[c].assign(frames + 5, CANARY);
+                cols.channel[c] = storage[c].data() + 1;
+            }
+        }
+
+        bool canariesIntact(size_t frames, uint8_t channels) const
+        {
+            for (uint8_t c = 0; c < channels; c++)
+            {
+                if (storage[c][0] != CANARY)
+                {
+                    return false;
+                }
+                for (size_t i = frames + 1; i < storage[c].size(); i++)
+                {
+                    if (storage[c][i] != CANARY)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+    };
+
+    bool sameColumns(const Columns& a, const Columns& b, size_t frames, uint8_t channels)
+    {
+        for (uint8_t c = 0; c < channels; c++)
+        {
+            if (std::memcmp(a.cols.channel[c], b.cols.channel[c], frames * sizeof(int16_t)) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void checkKernel(const Kernel& k, std::mt19937& rng)
+    {
+        size_t cases = 0;
+        for (int nine = 0; nine < 2; nine++)
+        {
+            const size_t  frameBytes = nine ? MPU9250_FRAME9_BYTES : MPU9250_FRAME_BYTES;
+            const uint8_t channels   = nine ? FRAME_CHANNEL_COUNT : FRAME_MAG_X;
+            const DecodeFn reference = nine ? decodeFrames9Scalar : decodeFramesScalar;
+            const DecodeFn kernel    = nine ? k.decode9 : k.decode;
+
+            for (size_t frames = 0; frames < MAX_FRAMES; frames++)
+            {
+                for (size_t offset = 0; offset < 4; offset++)
+                {
+                    /* Heap block ends at the last frame byte */
+                    std::vector<uint8_t> buffer(offset + frames * frameBytes);
+                    for (uint8_t& b : buffer)
+                    {
+                        b = (uint8_t)rng();
+                    }
+                    const uint8_t* src = buffer.data() + offset;
+
+                    Columns expected(frames);
+                    Columns actual(frames);
+                    reference(src, frames, expected.cols);
+                    kernel(src, frames, actual.cols);
+
+                    CHECK(sameColumns(expected, actual, frames, channels));
+                    CHECK(actual.canariesIntact(frames, channels));
+                    cases++;
+                }
+            }
+        }
+        std::printf("  %-8s %zu cases\n", k.name, cases);
+    }
+
+    void testKnownFrame()
+    {
+        /* ax=0x0102 ay=-2 az=0x7FFF t=-32768 gx=0x1234 gy=0 gz=-1, mag x=0x0102 y=-2 z=0x3456 (little-endian) */
+        const uint8_t frame[MPU9250_FRAME9_BYTES] = {
+            0x01, 0x02, 0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x00, 0x12, 0x34, 0x00, 0x00, 0xFF, 0xFF,
+            0x02, 0x01, 0xFE, 0xFF, 0x56, 0x34 };
+        const int16_t expected[FRAME_CHANNEL_COUNT] = {
+            0x0102, -2, 0x7FFF, -32768, 0x1234, 0, -1, 0x0102, -2, 0x3456 };
+
+        Columns out(1);
+        decodeFrames9(frame, 1, out.cols);
+        for (uint8_t c = 0; c < FRAME_CHANNEL_COUNT; c++)
+        {
+            CHECK(out.cols.channel[c][0] == expected[c]);
+        }
+    }
+}
+
+int main()
+{
+#if defined(__AVX2__)
+    if (!__builtin_cpu_supports("avx2"))
+    {
+        std::printf("test_decode: AVX2 not supported by this CPU, skipped\n");
+        return 77;
+    }
+#endif
+
+    std::printf("dispatch kernel: %s\n", decodeKernelName());
+    testKnownFrame();
+
+    std::mt19937 rng(1234);
+    const Kernel kernels[] = {
+        { "dispatch", decodeFrames, decodeFrames9 },
+#if defined(__SSE2__)
+        { "SSE2", decodeFramesSSE2, decodeFrames9SSE2 },
+#endif
+#if defined(__AVX2__)
+        { "AVX2", decodeFramesAVX2, decodeFrames9AVX2 },
+#endif
+#if defined(__ARM_ARCH_6M__)
+        { "M0+", decodeFramesM0, decodeFrames9M0 },
+#endif
+    };
+    for (const Kernel& k : kernels)
+    {
+        checkKernel(k, rng);
+    }
+    return testResult("test_decode");
+}
@@ -0,0 +1,190 @@
+/**
+ * @file  :test_init.cpp
+ * @brief :HAL init state machine against a simulated reset/wake/convert timeline.
+ *
+ * The fake MPU9250 holds H_RESET for 11 ms, then starts the accel 20 ms and
+ * the gyro 35 ms after wake (datasheet start-up times). Checks the bus write
+ * sequence of a cold start, the reported duration, the skip when the device
+ * already holds the configuration, and the timeout.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Service.hpp"
+#include "fake_mpu9250.hpp"
+#include "test_common.hpp"
+#include <utility>
+#include <vector>
+
+using namespace MPU9250Reg;
+
+namespace
+{
+    /* HAL limits, mirrored from MPU9250_HAL.cpp */
+    constexpr uint32_t INIT_TIMEOUT_US = 200000;
+    constexpr uint32_t INIT_POLL_US    = 500;
+
+    using WriteLog = std::vector<std::pair<uint8_t, uint8_t>>;
+
+    /* H_RESET, wake, then the SMPLRT_DIV .. ACCEL_CONFIG2 block in one burst */
+    const WriteLog COLD_START =
+    {
+        { PWR_MGMT_1::address,    0x80 },
+        { PWR_MGMT_1::address,    0x01 },
+        { SMPLRT_DIV::address,    0x04 },
+        { CONFIG::address,        0x03 },
+        { GYRO_CONFIG::address,   0x00 },
+        { ACCEL_CONFIG::address,  0x00 },
+        { ACCEL_CONFIG2::address, 0x03 },
+    };
+
+    void testColdStart()
+    {
+        HostShim::reset();
+        HostShim::setTime_us(1000);
+        FakeMpu9250 dev;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        IMUService  imu(hal);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+        CHECK(hal.initState() == InitState::IDLE);
+        CHECK(hal.initDuration_us() == 0);
+
+        CHECK(imu.begin());
+        CHECK(hal.initState() == InitState::READY);
+        CHECK(dev.writeLog() == COLD_START);
+
+        /* Reset + gyro start-up, plus at most one poll period and the bus traffic of the last polls */
+        const uint32_t floor_us = dev.resetTime_us + MPU9250_GYRO_SETTLE_US;
+        CHECK(hal.initDuration_us() >= floor_us);
+        CHECK(hal.initDuration_us() < floor_us + 2 * INIT_POLL_US + 1000);
+        CHECK(hal.initDuration_us() < 100000);  // tens of ms, against the old 150 ms of fixed sleeps
+
+        /* The first sample after begin() already has gyro data */
+        const IMUData first = imu.getAll();
+        CHECK_NEAR(first.gyro.x_dps, dev.gyro[0] / 131.0, 1e-5);
+        CHECK_NEAR(first.accel.z_g, 1.0, 1e-6);
+        CHECK(imu.timeToFirstSample_us() >= 1000 + hal.initDuration_us());
+
+        std::printf("cold start: READY after %u us, first sample at %u us\n",
+                    hal.initDuration_us(), imu.timeToFirstSample_us());
+    }
+
+    void testSkipWhenConfigured()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        IMUService  imu(hal);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+        CHECK(imu.begin());
+        const size_t writes = dev.writeLog().size();
+
+        /* Same configuration on the device: no reset, no writes, READY at once */
+        CHECK(hal.startInit(false));
+        CHECK(hal.initState() == InitState::READY);
+        CHECK(hal.initDuration_us() == 0);
+        CHECK(imu.begin());
+        CHECK(hal.initMPU9250());
+        CHECK(dev.writeLog().size() == writes);
+
+        /* Another MPU9250 with the same HAL settings (e.g. after an MCU reset) is adopted as is */
+        MPU9250_HAL again(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(again.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+        CHECK(again.initMPU9250());
+        CHECK(dev.writeLog().size() == writes);
+
+        /* A register that drifted forces the full sequence */
+        dev.regs[CONFIG::address] = 0x06;
+        CHECK(hal.startInit(false));
+        CHECK(hal.initState() == InitState::RESETTING);
+        CHECK(dev.writeLog().size() == writes + 1);
+        CHECK(dev.writeLog().back() == std::make_pair(PWR_MGMT_1::address, (uint8_t)0x80));
+
+        /* A start while in progress does not restart the reset */
+        CHECK(hal.startInit(false));
+        CHECK(dev.writeLog().size() == writes + 1);
+        while ((hal.pollInit() != InitState::READY) && (hal.initState() != InitState::FAILED))
+        {
+            HostShim::advance_us(INIT_POLL_US);
+        }
+        CHECK(hal.initState() == InitState::READY);
+        CHECK(dev.regs[CONFIG::address] == 0x03);
+
+        /* force always resets */
+        CHECK(hal.startInit(true));
+        CHECK(hal.initState() == InitState::RESETTING);
+        CHECK(dev.writeLog().back() == std::make_pair(PWR_MGMT_1::address, (uint8_t)0x80));
+    }
+
+    /* initMPU9250() on a device whose timeline never completes */
+    void expectTimeout(FakeMpu9250 &dev, InitState stuckIn)
+    {
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+
+        CHECK(hal.startInit(false));
+        const uint32_t start = time_us_32();
+        InitState last = hal.initState();
+        while (hal.initState() != InitState::FAILED)
+        {
+            last = hal.initState();
+            CHECK(hal.pollInit() != InitState::READY);
+            HostShim::advance_us(INIT_POLL_US);
+        }
+        CHECK(last == stuckIn);
+        CHECK(hal.initDuration_us() == 0);
+        const uint32_t elapsed = time_us_32() - start;
+        CHECK(elapsed > INIT_TIMEOUT_US);
+        CHECK(elapsed < INIT_TIMEOUT_US + 2 * INIT_POLL_US);
+
+        /* A retry starts over from reset and gives up the same way */
+        CHECK(!hal.initMPU9250());
+        CHECK(hal.initState() == InitState::FAILED);
+    }
+
+    void testTimeouts()
+    {
+        HostShim::reset();
+        FakeMpu9250 stuckReset;
+        stuckReset.resetTime_us = 10000000;
+        expectTimeout(stuckReset, InitState::RESETTING);
+
+        /* Accel converts but the gyro never does: not READY on accel data alone */
+        HostShim::reset();
+        FakeMpu9250 deadGyro;
+        deadGyro.gyro[0] = 0;
+        deadGyro.gyro[1] = 0;
+        deadGyro.gyro[2] = 0;
+        expectTimeout(deadGyro, InitState::WAIT_DATA);
+    }
+
+    void testGyroSettle()
+    {
+        /* Early gyro output is still inside its start-up time: READY waits for the settle deadline */
+        HostShim::reset();
+        FakeMpu9250 dev;
+        dev.accelStart_us = 1000;
+        dev.gyroStart_us  = 2000;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+
+        CHECK(hal.initMPU9250());
+        CHECK(hal.initDuration_us() >= dev.resetTime_us + MPU9250_GYRO_SETTLE_US);
+    }
+}
+
+int main()
+{
+    testColdStart();
+    testSkipWhenConfigured();
+    testTimeouts();
+    testGyroSettle();
+    return testResult("test_init");
+}
@@ -0,0 +1,258 @@
+/**
+ * @file  :test_preintegration.cpp
+ * @brief :Preintegrator coning and sculling against analytic trajectories.
+ *
+ * Coning: Savage's classical motion, attitude
+ *   q(t) = [cos(β/2), 0, sin(β/2) cos Ωt, sin(β/2) sin Ωt]
+ * with body rate ω = [-2Ω sin²(β/2), -Ω sin β sin Ωt, Ω sin β cos Ωt]. The
+ * reference increment is the rotation vector of q(t0)* ⊗ q(t1).
+ *
+ * Sculling: roll oscillation θ(t) = A sin Ωt about x with an in-phase
+ * linear vibration B sin Ωt along the reference y axis (no gravity). The
+ * reference Δv is the reference-frame velocity change rotated into the body
+ * frame at the start of the interval.
+ *
+ * The gyro/accel inputs are the exact per-sample integrals divided by the
+ * sample period, as a sensor averaging over each sample would report.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Preintegration.hpp"
+#include "test_common.hpp"
+#include <cmath>
+
+namespace
+{
+    constexpr double PI         = 3.14159265358979323846;
+    constexpr double RAD_TO_DEG = 180.0 / PI;
+    constexpr double G          = 9.80665;
+    constexpr double H          = 0.001;   // 1 kHz input
+    constexpr int    DECIMATION = 10;      // 100 Hz increments
+
+    struct Quat
+    {
+        double w, x, y, z;
+    };
+
+    Quat mul(const Quat &p, const Quat &r)
+    {
+        return { p.w * r.w - p.x * r.x - p.y * r.y - p.z * r.z,
+                 p.w * r.x + p.x * r.w + p.y * r.z - p.z * r.y,
+                 p.w * r.y - p.x * r.z + p.y * r.w + p.z * r.x,
+                 p.w * r.z + p.x * r.y - p.y * r.x + p.z * r.w };
+    }
+
+    void rotationVector(const Quat &q, double out[3])
+    {
+        const double s     = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+        const double angle = 2.0 * std::atan2(s, q.w);
+        const double k     = (s > 0.0) ? angle / s : 2.0;
+        out[0] = q.x * k;
+        out[1] = q.y * k;
+        out[2] = q.z * k;
+    }
+
+    double norm3(const double v[3])
+    {
+        return std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    }
+
+    PreintConfig config()
+    {
+        PreintConfig c;
+        c.decimation        = DECIMATION;
+        c.gyroNoiseDensity  = 0.0f;
+        c.accelNoiseDensity = 0.0f;
+        return c;
+    }
+
+    void testConing()
+    {
+        const double beta  = 0.05;
+        const double omega = 2.0 * PI * 20.0;
+        const double s     = std::sin(beta / 2.0);
+        const double c     = std::cos(beta / 2.0);
+
+        auto attitude = [&](double t) -> Quat
+        {
+            return { c, 0.0, s * std::cos(omega * t), s * std::sin(omega * t) };
+        };
+
+        Preintegrator pre(config());
+        double worstErr  = 0.0;
+        double worstRaw  = 0.0;
+        double driftTrue = 0.0;
+        double driftEst  = 0.0;
+        double rawSum[3] = { 0.0, 0.0, 0.0 };
+        int    increments = 0;
+
+        for (int n = 0; n < 1000; n++)
+        {
+            const double t0 = n * H;
+            const double t1 = t0 + H;
+
+            /* Exact integral of ω over the sample */
+            const double inc[3] =
+            {
+                -2.0 * omega * s * s * H,
+                std::sin(beta) * (std::cos(omega * t1) - std::cos(omega * t0)),
+                std::sin(beta) * (std::sin(omega * t1) - std::sin(omega * t0))
+            };
+            for (int i = 0; i < 3; i++)
+            {
+                rawSum[i] += inc[i];
+            }
+
+            GyroData  gyro  = { (float)(inc[0] / H * RAD_TO_DEG), (float)(inc[1] / H * RAD_TO_DEG), (float)(inc[2] / H * RAD_TO_DEG) };
+            AccelData accel = { 0.0f, 0.0f, 0.0f };
+            if (!pre.push(gyro, accel, (float)H))
+            {
+                continue;
+            }
+            increments++;
+
+            const double tStart = t1 - DECIMATION * H;
+            Quat q0 = attitude(tStart);
+            q0.x = -q0.x; q0.y = -q0.y; q0.z = -q0.z;
+            double truth[3];
+            rotationVector(mul(q0, attitude(t1)), truth);
+
+            const DeltaIncrement &d = pre.output();
+            double err[3];
+            double raw[3];
+            for (int i = 0; i < 3; i++)
+            {
+                err[i] = d.dTheta_rad[i] - truth[i];
+                raw[i] = rawSum[i] - truth[i];
+                rawSum[i] = 0.0;
+            }
+            worstErr = std::fmax(worstErr, norm3(err));
+            worstRaw = std::fmax(worstRaw, norm3(raw));
+            driftTrue += truth[0];
+            driftEst  += d.dTheta_rad[0];
+            CHECK(d.samples == DECIMATION);
+            CHECK_NEAR(d.dt_s, DECIMATION * H, 1e-6);
+        }
+
+        std::printf("coning:   worst |dTheta error| %.3e rad (uncorrected %.3e), x drift %.6f vs %.6f rad/s\n",
+                    worstErr, worstRaw, driftEst, driftTrue);
+        CHECK(increments == 1000 / DECIMATION);
+        /* Two-sample coning removes the rectified x drift that the plain sum misses */
+        CHECK(worstErr < worstRaw / 20.0);
+        CHECK(worstErr < 3e-6);
+        CHECK_NEAR(driftEst, driftTrue, std::fabs(driftTrue) * 1e-3);
+    }
+
+    void testSculling()
+    {
+        const double A     = 0.02;                // roll amplitude, rad
+        const double B     = 20.0;                // vibration amplitude, m/s²
+        const double omega = 2.0 * PI * 15.0;
+
+        auto theta = [&](double t) { return A * std::sin(omega * t); };
+
+        /* Body-frame specific force: R_x(θ)^T (0, B sin Ωt, 0) */
+        auto forceY = [&](double t) { return  B * std::sin(omega * t) * std::cos(theta(t)); };
+        auto forceZ = [&](double t) { return -B * std::sin(omega * t) * std::sin(theta(t)); };
+
+        /* Simpson over each sample, fine enough to be exact at float precision */
+        auto integrate = [&](auto f, double t0, double t1)
+        {
+            const int    m = 64;
+            const double h = (t1 - t0) / m;
+            double sum = f(t0) + f(t1);
+            for (int k = 1; k < m; k++)
+            {
+                sum += f(t0 + k * h) * ((k & 1) ? 4.0 : 2.0);
+            }
+            return sum * h / 3.0;
+        };
+
+        Preintegrator pre(config());
+        double worstErr  = 0.0;
+        double worstRaw  = 0.0;
+        double rawSum[3] = { 0.0, 0.0, 0.0 };
+        double zTrue     = 0.0;
+        double zEst      = 0.0;
+
+        for (int n = 0; n < 1000; n++)
+        {
+            const double t0 = n * H;
+            const double t1 = t0 + H;
+
+            const double dAngle = theta(t1) - theta(t0);
+            const double dv[3]  = { 0.0, integrate(forceY, t0, t1), integrate(forceZ, t0, t1) };
+            for (int i = 0; i < 3; i++)
+            {
+                rawSum[i] += dv[i];
+            }
+
+            GyroData  gyro  = { (float)(dAngle / H * RAD_TO_DEG), 0.0f, 0.0f };
+            AccelData accel = { 0.0f, (float)(dv[1] / H / G), (float)(dv[2] / H / G) };
+            if (!pre.push(gyro, accel, (float)H))
+            {
+                continue;
+            }
+
+            /* Reference velocity change rotated into the body frame at the interval start */
+            const double tStart = t1 - DECIMATION * H;
+            const double dvRef  = B / omega * (std::cos(omega * tStart) - std::cos(omega * t1));
+            const double th0    = theta(tStart);
+            const double truth[3] = { 0.0, dvRef * std::cos(th0), -dvRef * std::sin(th0) };
+
+            const DeltaIncrement &d = pre.output();
+            double err[3];
+            double raw[3];
+            for (int i = 0; i < 3; i++)
+            {
+                err[i] = d.dVel_mps[i] - truth[i];
+                raw[i] = rawSum[i] - truth[i];
+                rawSum[i] = 0.0;
+            }
+            worstErr = std::fmax(worstErr, norm3(err));
+            worstRaw = std::fmax(worstRaw, norm3(raw));
+            zTrue += truth[2];
+            zEst  += d.dVel_mps[2];
+        }
+
+        std::printf("sculling: worst |dVel error| %.3e m/s (uncorrected %.3e), z sum %.6f vs %.6f m/s\n",
+                    worstErr, worstRaw, zEst, zTrue);
+        CHECK(worstErr < worstRaw / 20.0);
+        CHECK(worstErr < 1e-5);
+    }
+
+    void testStaticAndReset()
+    {
+        /* Constant rate about one axis: no coning, Δθ = ω T exactly */
+        Preintegrator pre(config());
+        const GyroData  gyro  = { 0.0f, 0.0f, 90.0f };
+        const AccelData accel = { 0.0f, 0.0f, 1.0f };
+        for (int n = 0; n < DECIMATION; n++)
+        {
+            CHECK(pre.push(gyro, accel, (float)H) == (n == DECIMATION - 1));
+        }
+        CHECK_NEAR(pre.output().dTheta_rad[2], PI / 2.0 * DECIMATION * H, 1e-7);
+        CHECK_NEAR(pre.output().dTheta_rad[0], 0.0, 1e-9);
+        CHECK_NEAR(pre.output().dVel_mps[2], G * DECIMATION * H, 1e-6);
+
+        pre.push(gyro, accel, (float)H);
+        pre.reset();
+        for (int n = 0; n < DECIMATION - 1; n++)
+        {
+            CHECK(!pre.push(gyro, accel, (float)H));
+        }
+        CHECK(pre.push(gyro, accel, (float)H));
+    }
+}
+
+int main()
+{
+    testConing();
+    testSculling();
+    testStaticAndReset();
+    return testResult("test_preintegration");
+}
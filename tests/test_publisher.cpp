@@ -0,0 +1,212 @@
+/**
+ * @file  :test_publisher.cpp
+ * @brief :Stress test of SamplePublisher/SampleReader with concurrent std::thread readers.
+ *
+ * One writer publishes samples whose every field is derived from the
+ * publication number while several SampleReader cursors and a readLatest()
+ * poller run on other threads. Every snapshot must be internally consistent
+ * (no torn reads), cursors must see strictly increasing numbers, and each
+ * cursor must account for every sample: received + missed == published.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Publisher.hpp"
+#include "test_common.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t PUBLISHED     = 1000000;
+    constexpr int      READERS       = 3;
+    constexpr uint32_t WRITER_BURST  = 4;      // writer yields after this many samples...
+    constexpr uint32_t OVERRUN_BLOCK = 8192;   // ...except in every other block of this size, to force overruns
+
+    IMUData makeData(uint32_t number)
+    {
+        /* Exactly representable, different in every field */
+        const float base = (float)(number & 0xFFFFu);
+        IMUData d;
+        d.accel = { base + 0.25f, base + 0.50f, base + 0.75f };
+        d.gyro  = { base + 1.25f, base + 1.50f, base + 1.75f };
+        d.temp  = { base + 2.25f };
+        d.mag   = { base + 3.25f, base + 3.50f, base + 3.75f };
+        return d;
+    }
+
+    bool consistent(const PublishedSample &s)
+    {
+        const IMUData d = makeData(s.number);
+        return (s.timestamp_us == s.number * 7u) &&
+               (s.data.accel.x_g == d.accel.x_g) && (s.data.accel.y_g == d.accel.y_g) &&
+               (s.data.accel.z_g == d.accel.z_g) && (s.data.gyro.x_dps == d.gyro.x_dps) &&
+               (s.data.gyro.y_dps == d.gyro.y_dps) && (s.data.gyro.z_dps == d.gyro.z_dps) &&
+               (s.data.temp.temperature_c == d.temp.temperature_c) &&
+               (s.data.mag.x_uT == d.mag.x_uT) && (s.data.mag.y_uT == d.mag.y_uT) &&
+               (s.data.mag.z_uT == d.mag.z_uT);
+    }
+
+    struct ReaderResult
+    {
+        uint32_t received  = 0;
+        uint32_t missed    = 0;
+        uint32_t torn      = 0;
+        uint32_t unordered = 0;
+    };
+
+    void testSingleThreadedOverrun()
+    {
+        SamplePublisher pub;
+        SampleReader reader(pub);
+        PublishedSample s;
+
+        CHECK(!reader.next(s));
+        CHECK(!pub.readLatest(s));
+
+        for (uint32_t n = 1; n <= 20; n++)
+        {
+            pub.publish(makeData(n), n * 7u);
+        }
+
+        uint32_t received = 0;
+        uint32_t last     = 0;
+        while (reader.next(s))
+        {
+            CHECK(consistent(s));
+            CHECK(s.number > last);
+            last = s.number;
+            received++;
+        }
+        CHECK(last == 20);
+        CHECK(received + reader.missed() == 20);
+        CHECK(received == PUBLISHER_SLOTS - 1);
+
+        CHECK(pub.readLatest(s));
+        CHECK(s.number == 20);
+        CHECK(consistent(s));
+    }
+
+    void testConcurrentReaders()
+    {
+        SamplePublisher pub;
+        std::atomic<bool> writerDone(false);
+        std::atomic<int>  ready(0);
+
+        std::vector<SampleReader> cursors;
+        for (int r = 0; r < READERS; r++)
+        {
+            cursors.emplace_back(pub);
+        }
+
+        ReaderResult results[READERS];
+        std::vector<std::thread> threads;
+        for (int r = 0; r < READERS; r++)
+        {
+            threads.emplace_back([&, r]()
+            {
+                SampleReader &reader = cursors[r];
+                ReaderResult &res    = results[r];
+                PublishedSample s;
+                uint32_t last = 0;
+                ready++;
+                while (true)
+                {
+                    const bool done = writerDone.load(std::memory_order_acquire);
+                    bool any = false;
+                    while (reader.next(s))
+                    {
+                        any = true;
+                        res.received++;
+                        if (!consistent(s))
+                        {
+                            res.torn++;
+                        }
+                        if (s.number <= last)
+                        {
+                            res.unordered++;
+                        }
+                        last = s.number;
+                    }
+                    if (done && !any)
+                    {
+                        break;
+                    }
+                    if (!any)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                res.missed = reader.missed();
+            });
+        }
+
+        uint32_t latestTorn = 0;
+        uint32_t latestBack = 0;
+        threads.emplace_back([&]()
+        {
+            PublishedSample s;
+            uint32_t last = 0;
+            ready++;
+            while (!writerDone.load(std::memory_order_acquire))
+            {
+                if (pub.readLatest(s))
+                {
+                    if (!consistent(s))
+                    {
+                        latestTorn++;
+                    }
+                    if (s.number < last)
+                    {
+                        latestBack++;
+                    }
+                    last = s.number;
+                }
+                std::this_thread::yield();
+            }
+        });
+
+        while (ready.load() < READERS + 1)
+        {
+            std::this_thread::yield();
+        }
+        for (uint32_t n = 1; n <= PUBLISHED; n++)
+        {
+            pub.publish(makeData(n), n * 7u);
+            if (((n % WRITER_BURST) == 0) && ((n & OVERRUN_BLOCK) == 0))
+            {
+                /* Let the readers keep up (also on single-core hosts), except in every other block */
+                std::this_thread::yield();
+            }
+        }
+        writerDone.store(true, std::memory_order_release);
+
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+
+        CHECK(pub.latestNumber() == PUBLISHED);
+        for (int r = 0; r < READERS; r++)
+        {
+            std::printf("reader %d: received %u missed %u\n", r, results[r].received, results[r].missed);
+            CHECK(results[r].torn == 0);
+            CHECK(results[r].unordered == 0);
+            CHECK(results[r].received + results[r].missed == PUBLISHED);
+            CHECK(results[r].received > 0);
+        }
+        CHECK(latestTorn == 0);
+        CHECK(latestBack == 0);
+    }
+}
+
+int main()
+{
+    testSingleThreadedOverrun();
+    testConcurrentReaders();
+    return testResult("test_publisher");
+}
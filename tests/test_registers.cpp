@@ -0,0 +1,144 @@
+/**
+ * @file  :test_registers.cpp
+ * @brief :Read planner layout, the HAL read paths built on it, and field writes.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Service.hpp"
+#include "fake_mpu9250.hpp"
+#include "test_common.hpp"
+
+using namespace MPU9250Reg;
+
+namespace
+{
+    void testPlanLayout()
+    {
+        /* Unordered input with a duplicate and a gap inside one burst block */
+        constexpr auto plan = planReads<6>({WHO_AM_I::address, GYRO_ZOUT_L::address, ACCEL_XOUT_H::address,
+                                            ACCEL_XOUT_H::address, PWR_MGMT_1::address, INT_STATUS::address});
+        static_assert(plan.count == 3, "INT_STATUS..GYRO, PWR_MGMT_1, WHO_AM_I");
+        CHECK(plan.spans[0].first == INT_STATUS::address);
+        CHECK(plan.spans[0].length == GYRO_ZOUT_L::address - INT_STATUS::address + 1);
+        CHECK(plan.spans[1].first == PWR_MGMT_1::address);
+        CHECK(plan.spans[2].first == WHO_AM_I::address);
+        CHECK(planBytes(plan) == plan.spans[0].length + 2u);
+        CHECK(planOffset(plan, ACCEL_XOUT_H::address) == 1);
+        CHECK(planOffset(plan, PWR_MGMT_1::address) == plan.spans[0].length);
+        CHECK(planOffset(plan, WHO_AM_I::address) == plan.spans[0].length + 1u);
+        CHECK(planOffset(plan, FIFO_R_W::address) == planBytes(plan));  // not in the plan
+
+        /* Registers on either side of a block boundary stay separate */
+        constexpr auto split = planReads<2>({WOM_THR::address, 0x20});
+        static_assert(split.count == 2, "WOM_THR ends the SMPLRT_DIV burst block");
+
+        constexpr auto words = wordRegs<2>({TEMP_OUT_H::address, GYRO_XOUT_H::address});
+        static_assert(planReads(words).count == 1 && planBytes(planReads(words)) == 4, "TEMP + GYRO_X in one burst");
+    }
+
+    void testReadPaths()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev;
+        dev.accel[0] = -1234;
+        dev.accel[1] = 4321;
+        dev.accel[2] = 16000;
+        dev.gyro[0]  = -7;
+        dev.gyro[1]  = 300;
+        dev.gyro[2]  = -32768;
+        dev.temp     = -200;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        IMUService  imu(hal);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+        CHECK(imu.begin());
+
+        /* Each readBytes() is a register-pointer write plus one read */
+        uint32_t before = HostShim::i2cTransfers();
+        int16_t ax, ay, az, gx, gy, gz, temp;
+        CHECK(hal.readAllRaw(ax, ay, az, gx, gy, gz, temp));
+        CHECK(HostShim::i2cTransfers() - before == 2);
+        CHECK((ax == -1234) && (ay == 4321) && (az == 16000));
+        CHECK((gx == -7) && (gy == 300) && (gz == -32768));
+        CHECK(temp == -200);
+
+        before = HostShim::i2cTransfers();
+        CHECK(hal.readAccelRaw(ax, ay, az) && hal.readGyroRaw(gx, gy, gz) && hal.readTempRaw(temp));
+        CHECK(HostShim::i2cTransfers() - before == 6);
+        CHECK((ax == -1234) && (gz == -32768) && (temp == -200));
+
+        before = HostShim::i2cTransfers();
+        const IMUData all = imu.getAll();
+        CHECK(HostShim::i2cTransfers() - before == 2);
+        CHECK_NEAR(all.gyro.y_dps, 300 / 131.0, 1e-5);
+
+        /* Verifying the configuration: PWR_MGMT_1 and the config block are two bursts */
+        before = HostShim::i2cTransfers();
+        CHECK(hal.startInit(false));
+        CHECK(hal.initState() == InitState::READY);
+        CHECK(HostShim::i2cTransfers() - before == 4);
+    }
+
+    void testFieldWrites()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+        CHECK(hal.initMPU9250());
+        CHECK(dev.regs[CONFIG::address] == 0x03);
+
+        /* Shadowed register: no read, DLPF_CFG kept, and the shadow follows */
+        uint32_t before = HostShim::i2cTransfers();
+        CHECK(hal.writeReg(CONFIG::EXT_SYNC_SET(2)));
+        CHECK(HostShim::i2cTransfers() - before == 1);
+        CHECK(dev.regs[CONFIG::address] == 0x13);
+        const size_t writes = dev.writeLog().size();
+        CHECK(hal.startInit(false));
+        CHECK(hal.initState() == InitState::READY);
+        CHECK(dev.writeLog().size() == writes);
+
+        /* Unshadowed register: read-modify-write over the bus */
+        CHECK(hal.writeReg(INT_ENABLE::RAW_RDY_EN(true)));
+        before = HostShim::i2cTransfers();
+        CHECK(hal.writeReg(INT_ENABLE::FIFO_OFLOW_EN(true)));
+        CHECK(HostShim::i2cTransfers() - before == 3);
+        CHECK(dev.regs[INT_ENABLE::address] == 0x11);
+
+        CHECK(hal.writeReg(PWR_MGMT_1::GYRO_STANDBY(true)));
+        CHECK(dev.regs[PWR_MGMT_1::address] == 0x11);  // CLKSEL kept
+        CHECK(hal.writeReg(PWR_MGMT_1::GYRO_STANDBY(false)));
+        CHECK(dev.regs[PWR_MGMT_1::address] == 0x01);
+
+        /* whole(): written as is, without the read */
+        before = HostShim::i2cTransfers();
+        CHECK(hal.writeReg(INT_ENABLE::WOM_EN(true).whole()));
+        CHECK(HostShim::i2cTransfers() - before == 1);
+        CHECK(dev.regs[INT_ENABLE::address] == 0x40);
+
+        /* INT_PIN_CFG: bypass and wake-on-motion add their bit to what the application set */
+        CHECK(hal.writeReg(INT_PIN_CFG::ACTL(true)));
+        CHECK(hal.initAK8963());
+        CHECK(dev.regs[INT_PIN_CFG::address] == 0x82);
+        CHECK(hal.enterWakeOnMotion(100, LpAccelOdr::HZ_31_25));
+        CHECK(dev.regs[INT_PIN_CFG::address] == 0xA2);
+        CHECK(dev.regs[ACCEL_CONFIG2::address] == 0x00);  // BW_218HZ
+        CHECK(hal.exitWakeOnMotion());
+        CHECK(dev.regs[INT_PIN_CFG::address] == 0x82);
+        CHECK(dev.regs[ACCEL_CONFIG2::address] == 0x03);
+        CHECK(dev.regs[CONFIG::address] == 0x13);
+    }
+}
+
+int main()
+{
+    testPlanLayout();
+    testReadPaths();
+    testFieldWrites();
+    return testResult("test_registers");
+}
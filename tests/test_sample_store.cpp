@@ -0,0 +1,225 @@
+/**
+ * @file  :test_sample_store.cpp
+ * @brief :SampleStore timestamps across long gaps, ring wrap and raw-to-unit conversion.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_SampleStore.hpp"
+#include "test_common.hpp"
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /* Rebuilt times are rounded to the nearest tick */
+    constexpr double TIME_TOL_US = STORE_TICK_US / 2;
+
+    void makeChannels(uint32_t n, int16_t ch[FRAME_CHANNEL_COUNT])
+    {
+        for (uint8_t c = 0; c < FRAME_CHANNEL_COUNT; c++)
+        {
+            ch[c] = (int16_t)(n * 31 + c * 1000);
+        }
+    }
+
+    void testLongGaps()
+    {
+        /* A gap of ~2 s used to be clamped to 262 ms and the remainder smeared over later samples */
+        static SampleStore store;
+        const uint32_t pushed[] = { 1000, 1003, 2000000, 2000100 };
+        int16_t ch[FRAME_CHANNEL_COUNT];
+        for (uint32_t t : pushed)
+        {
+            makeChannels(t, ch);
+            CHECK(store.push(ch, t));
+        }
+
+        uint32_t ts[4];
+        IMUData  out[4];
+        const SampleScale scale = { 1.0f, 1.0f, 1.0f, 0.0f, 1.0f };
+        CHECK(store.readBatch(out, ts, 4, scale) == 4);
+        for (int i = 0; i < 4; i++)
+        {
+            CHECK_NEAR(ts[i], pushed[i], TIME_TOL_US);
+        }
+        CHECK(ts[2] == 2000000);
+        CHECK(ts[3] == 2000100);
+
+        /* Same through pop() */
+        for (uint32_t t : pushed)
+        {
+            makeChannels(t, ch);
+            CHECK(store.push(ch, t));
+        }
+        RawFrame frame;
+        uint32_t t;
+        for (int i = 0; i < 4; i++)
+        {
+            CHECK(store.pop(frame, t));
+            CHECK_NEAR(t, pushed[i], TIME_TOL_US);
+            makeChannels(pushed[i], ch);
+            CHECK(frame.channel[FRAME_GYRO_Z] == ch[FRAME_GYRO_Z]);
+        }
+        CHECK(!store.pop(frame, t));
+        CHECK(store.dropped() == 0);
+    }
+
+    void testBackwardsTime()
+    {
+        static SampleStore store;
+        const uint32_t pushed[] = { 5000, 6000, 4000, 4500, 0xFFFFFF00u, 100 };
+        int16_t ch[FRAME_CHANNEL_COUNT] = {};
+        for (uint32_t t : pushed)
+        {
+            CHECK(store.push(ch, t));
+        }
+        uint32_t ts[6];
+        IMUData  out[6];
+        const SampleScale scale = { 1.0f, 1.0f, 1.0f, 0.0f, 1.0f };
+        CHECK(store.readBatch(out, ts, 6, scale) == 6);
+        for (int i = 0; i < 6; i++)
+        {
+            CHECK_NEAR((int32_t)(ts[i] - pushed[i]), 0, TIME_TOL_US);
+        }
+    }
+
+    void testResyncSlotsExhausted()
+    {
+        static SampleStore store;
+        int16_t ch[FRAME_CHANNEL_COUNT] = {};
+        uint32_t t = 0;
+        CHECK(store.push(ch, t));
+        for (uint32_t i = 0; i < STORE_RESYNC_SLOTS; i++)
+        {
+            t += 1000000;
+            CHECK(store.push(ch, t));
+        }
+
+        /* Every slot holds an unread gap: the next gap is rejected, short steps still fit */
+        CHECK(!store.push(ch, t + 1000000));
+        CHECK(store.dropped() == 1);
+        CHECK(store.push(ch, t + 1000));
+        CHECK(store.size() == STORE_RESYNC_SLOTS + 2);
+
+        /* Reading frees slots again */
+        store.discard(2);
+        CHECK(store.push(ch, t + 5000000));
+
+        /* pushFrames stops at the first frame that cannot be stamped */
+        static SampleStore burst;
+        static uint8_t bytes[20 * MPU9250_FRAME_BYTES];
+        CHECK(burst.pushFrames(bytes, 20, false, 0, 300000) == STORE_RESYNC_SLOTS + 1);
+        CHECK(burst.dropped() == 20 - (STORE_RESYNC_SLOTS + 1));
+        RawFrame frame;
+        uint32_t ts;
+        for (uint32_t i = 0; i <= STORE_RESYNC_SLOTS; i++)
+        {
+            CHECK(burst.pop(frame, ts));
+            CHECK(ts == i * 300000);
+        }
+    }
+
+    /* Random gaps, bursts and reads through every API, checked against a reference queue */
+    void testRandomAgainstReference()
+    {
+        static SampleStore store;
+        std::mt19937 rng(99);
+        std::deque<std::pair<uint32_t, int16_t>> expected;  // time, GYRO_X
+        uint32_t now = 0x7FFFF000u;  // crosses the 32-bit wrap
+        uint32_t n   = 0;
+        const SampleScale scale = { 1.0f, 1.0f, 1.0f, 0.0f, 1.0f };
+
+        for (int step = 0; step < 20000; step++)
+        {
+            const uint32_t r = rng() % 100;
+            if (r < 60)
+            {
+                const uint32_t gap = (rng() % 50 == 0) ? (300000 + rng() % 3000000) : (1 + rng() % 5000);
+                now += gap;
+                int16_t ch[FRAME_CHANNEL_COUNT];
+                makeChannels(n, ch);
+                const uint32_t before = store.dropped();
+                if (store.push(ch, now))
+                {
+                    expected.emplace_back(now, ch[FRAME_GYRO_X]);
+                }
+                else
+                {
+                    CHECK(store.dropped() == before + 1);
+                }
+                n++;
+            }
+            else if (r < 75)
+            {
+                RawFrame frame;
+                uint32_t t;
+                const bool got = store.pop(frame, t);
+                CHECK(got == !expected.empty());
+                if (got)
+                {
+                    CHECK_NEAR((int32_t)(t - expected.front().first), 0, TIME_TOL_US);
+                    CHECK(frame.channel[FRAME_GYRO_X] == expected.front().second);
+                    expected.pop_front();
+                }
+            }
+            else if (r < 95)
+            {
+                IMUData  out[40];
+                uint32_t ts[40];
+                const size_t want = rng() % 40;
+                const size_t got  = store.readBatch(out, ts, want, scale);
+                CHECK(got == std::min(want, expected.size()));
+                for (size_t i = 0; i < got; i++)
+                {
+                    CHECK_NEAR((int32_t)(ts[i] - expected.front().first), 0, TIME_TOL_US);
+                    CHECK(out[i].gyro.x_dps == (float)expected.front().second);
+                    expected.pop_front();
+                }
+            }
+            else
+            {
+                const size_t count = rng() % 8;
+                store.discard(count);
+                for (size_t i = 0; (i < count) && !expected.empty(); i++)
+                {
+                    expected.pop_front();
+                }
+            }
+            CHECK(store.size() == expected.size());
+        }
+    }
+
+    void testConversion()
+    {
+        static SampleStore store;
+        int16_t ch[FRAME_CHANNEL_COUNT] = { 16384, -8192, 100, 340, 131, -262, 0, 50, -50, 7 };
+        CHECK(store.push(ch, 10));
+
+        const SampleScale scale = { 1.0f / 16384.0f, 1.0f / 131.0f, 1.0f / 333.87f, 21.0f, 0.15f };
+        IMUData  out;
+        uint32_t ts;
+        CHECK(store.readBatch(&out, &ts, 1, scale) == 1);
+        CHECK(ts == 10);
+        CHECK_NEAR(out.accel.x_g, 1.0, 1e-6);
+        CHECK_NEAR(out.accel.y_g, -0.5, 1e-6);
+        CHECK_NEAR(out.gyro.x_dps, 1.0, 1e-6);
+        CHECK_NEAR(out.gyro.y_dps, -2.0, 1e-6);
+        CHECK_NEAR(out.temp.temperature_c, 340.0 / 333.87 + 21.0, 1e-5);
+        CHECK_NEAR(out.mag.z_uT, 7 * 0.15, 1e-6);
+    }
+}
+
+int main()
+{
+    testLongGaps();
+    testBackwardsTime();
+    testResyncSlotsExhausted();
+    testRandomAgainstReference();
+    testConversion();
+    return testResult("test_sample_store");
+}
@@ -0,0 +1,91 @@
+/**
+ * @file  :test_telemetry.cpp
+ * @brief :TelemetryLine formatting and TelemetryWriter output on the host UART shim.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Telemetry.hpp"
+#include "host_shim.hpp"
+#include "test_common.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+namespace
+{
+    void testFormatting()
+    {
+        char buf[96];
+        TelemetryLine line(buf, sizeof(buf));
+
+        line.text("Acc(g): ").fixed(0.01234f, 4).text(" ").fixed(-1.5f, 3).text(" ").fixed(16.0f, 0).newline();
+        CHECK(std::strcmp(line.data(), "Acc(g): 0.0123 -1.500 16\n") == 0);
+
+        line.clear().integer(0).put(' ').integer(-42).put(' ').integer(INT32_MIN);
+        CHECK(std::strcmp(line.data(), "0 -42 -2147483648") == 0);
+
+        line.clear().fixedPoint(-5, 3).put(' ').fixedPoint(123456, 2);
+        CHECK(std::strcmp(line.data(), "-0.005 1234.56") == 0);
+
+        line.clear().fixed(NAN, 2);
+        CHECK(std::strcmp(line.data(), "nan") == 0);
+        CHECK(!line.overflowed());
+    }
+
+    void testFixedMatchesValue()
+    {
+        /* Every printed value parses back to within half a unit of the last digit */
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> dist(-2000.0f, 2000.0f);
+        char buf[32];
+        for (int i = 0; i < 20000; i++)
+        {
+            const float   v        = dist(rng);
+            const uint8_t decimals = (uint8_t)(i % 5);
+            TelemetryLine line(buf, sizeof(buf));
+            line.fixed(v, decimals);
+            const double back = std::strtod(line.data(), nullptr);
+            CHECK_NEAR(back, v, 0.5 * std::pow(10.0, -decimals) * 1.001 + 1e-4);
+        }
+    }
+
+    void testOverflow()
+    {
+        char buf[8];
+        TelemetryLine line(buf, sizeof(buf));
+        line.text("0123456789");
+        CHECK(line.overflowed());
+        CHECK(line.length() == sizeof(buf) - 1);
+        CHECK(std::strcmp(line.data(), "0123456") == 0);
+    }
+
+    void testWriter()
+    {
+        HostShim::reset();
+        TelemetryWriter writer(uart_default);
+        CHECK(writer.begin(PICO_DEFAULT_UART_TX_PIN, 115200));
+
+        char buf[64];
+        TelemetryLine line(buf, sizeof(buf));
+        line.text("TEMP(C): ").fixed(25.125f, 2).newline();
+        CHECK(writer.writeLine(line));
+        writer.service();
+        CHECK(!writer.busy());
+        CHECK(HostShim::uartOutput() == "TEMP(C): 25.13\n");
+        CHECK(writer.dropped() == 0);
+    }
+}
+
+int main()
+{
+    testFormatting();
+    testFixedMatchesValue();
+    testOverflow();
+    testWriter();
+    return testResult("test_telemetry");
+}
@@ -0,0 +1,205 @@
+/**
+ * @file  :test_tempcomp.cpp
+ * @brief :TempBiasBuilder fit and TempCompensator interpolation/deadband.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_TempComp.hpp"
+#include "test_common.hpp"
+#include <cmath>
+
+namespace
+{
+    /* Breakpoints every 5 °C from 0 °C; axis a has a slope of 4 * (a + 1) LSB per breakpoint */
+    TempBiasTable makeTable()
+    {
+        TempBiasTable t = {};
+        t.tempStart_cC = 0;
+        t.tempStep_cC  = 500;
+        for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+        {
+            for (uint8_t i = 0; i < TEMP_COMP_POINTS; i++)
+            {
+                t.bias[a][i] = (int16_t)(4 * (a + 1) * i - 10);
+            }
+        }
+        return t;
+    }
+
+    /* Table value at temp_c, continuous */
+    float expectedBias(uint8_t axis, float temp_c)
+    {
+        return 4.0f * (axis + 1) * (temp_c / 5.0f) - 10.0f;
+    }
+
+    void testInterpolation()
+    {
+        const TempBiasTable table = makeTable();
+        TempCompensator comp(table);
+
+        const float temps[] = { 0.0f, 2.5f, 12.4f, 37.5f, 74.9f };
+        for (float t : temps)
+        {
+            comp.update(t);
+            for (uint8_t a = 0; a < TC_AXIS_COUNT; a++)
+            {
+                CHECK_NEAR(comp.bias((TempCompAxis)a), std::lround(expectedBias(a, t)), 0.0);
+            }
+        }
+
+        /* Held flat outside the table */
+        comp.update(-20.0f);
+        CHECK(comp.bias(TC_GYRO_Z) == table.bias[TC_GYRO_Z][0]);
+        comp.update(200.0f);
+        CHECK(comp.bias(TC_GYRO_Z) == table.bias[TC_GYRO_Z][TEMP_COMP_POINTS - 1]);
+    }
+
+    void testDeadband()
+    {
+        const TempBiasTable table = makeTable();
+        TempCompensator comp(table);
+
+        /* Gyro Z moves 4.8 LSB/°C: 134.48 LSB at 30.1 °C, so +0.056 °C would round up to 135 */
+        const float base = 30.1f;
+        const float step = TEMP_COMP_DEADBAND_C * 0.9f;
+        comp.update(base);
+        const int16_t atBase = comp.bias(TC_GYRO_Z);
+        CHECK(atBase == 134);
+        CHECK(std::lround(expectedBias(TC_GYRO_Z, base + step)) == 135);
+
+        comp.update(base + step);
+        CHECK(comp.bias(TC_GYRO_Z) == atBase);
+        comp.update(base - step);
+        CHECK(comp.bias(TC_GYRO_Z) == atBase);
+
+        /* Sensor noise (1 LSB = 1/333.87 °C) around a fixed point never re-evaluates */
+        for (int i = 0; i < 100; i++)
+        {
+            comp.update(base + ((i % 7) - 3) / 333.87f);
+            CHECK(comp.bias(TC_GYRO_Z) == atBase);
+        }
+
+        comp.update(31.0f);
+        CHECK(comp.bias(TC_GYRO_Z) == std::lround(expectedBias(TC_GYRO_Z, 31.0f)));
+
+        /* Invalid readings keep the last biases */
+        comp.update(NAN);
+        CHECK(comp.bias(TC_GYRO_Z) == std::lround(expectedBias(TC_GYRO_Z, 31.0f)));
+    }
+
+    void testCorrection()
+    {
+        const TempBiasTable table = makeTable();
+        TempCompensator comp(table);
+        comp.update(10.0f);
+
+        int16_t ax = 100, ay = 100, az = INT16_MIN;
+        comp.correctAccel(ax, ay, az);
+        CHECK(ax == 100 - comp.bias(TC_ACCEL_X));
+        CHECK(ay == 100 - comp.bias(TC_ACCEL_Y));
+        CHECK(az == ((comp.bias(TC_ACCEL_Z) > 0) ? INT16_MIN : INT16_MIN - comp.bias(TC_ACCEL_Z)));
+
+        int16_t gx = INT16_MAX, gy = 0, gz = -5;
+        comp.correctGyro(gx, gy, gz);
+        CHECK(gx == ((comp.bias(TC_GYRO_X) < 0) ? INT16_MAX : INT16_MAX - comp.bias(TC_GYRO_X)));
+        CHECK(gy == -comp.bias(TC_GYRO_Y));
+        CHECK(gz == -5 - comp.bias(TC_GYRO_Z));
+    }
+
+    /* Static log of a 10 LSB/°C gyro ramp (and an accel Z ramp on top of 1 g) warming from 20 °C */
+    void logRamp(TempBiasBuilder &builder, float from_c, float to_c)
+    {
+        for (float t = from_c; t <= to_c; t += 0.01f)
+        {
+            int16_t raw[TC_AXIS_COUNT] = {};
+            raw[TC_ACCEL_Z] = (int16_t)(16384 + std::lround(-4.0f * (t - 20.0f)));
+            raw[TC_GYRO_X]  = (int16_t)std::lround(10.0f * (t - 20.0f));
+            builder.addSample(t, raw);
+        }
+    }
+
+    void testBuilderRamp()
+    {
+        TempBiasBuilder builder(20.0f, 1.0f);
+        const int16_t reference[TC_AXIS_COUNT] = { 0, 0, 16384, 0, 0, 0 };
+        builder.setReference(reference);
+        logRamp(builder, 20.0f, 35.0f);
+
+        TempBiasTable table;
+        CHECK(builder.build(table));
+        CHECK(table.tempStart_cC == 2000);
+        CHECK(table.tempStep_cC == 100);
+
+        /* The end bins only see half of their range; their breakpoints must still sit on the line */
+        for (uint8_t i = 0; i < TEMP_COMP_POINTS; i++)
+        {
+            CHECK_NEAR(table.bias[TC_GYRO_X][i], 10 * i, 1);
+            CHECK_NEAR(table.bias[TC_ACCEL_Z][i], -4 * i, 1);
+            CHECK(table.bias[TC_GYRO_Y][i] == 0);
+        }
+        CHECK(table.bias[TC_GYRO_X][0] == 0);
+        CHECK(table.bias[TC_GYRO_X][TEMP_COMP_POINTS - 1] == 150);
+
+        /* Applied back to the log, the compensated ramp is flat */
+        TempCompensator comp(table);
+        for (float t = 20.0f; t <= 35.0f; t += 0.37f)
+        {
+            comp.update(t);
+            int16_t gx = (int16_t)std::lround(10.0f * (t - 20.0f));
+            int16_t gy = 0;
+            int16_t gz = 0;
+            comp.correctGyro(gx, gy, gz);
+            CHECK_NEAR(gx, 0, 2);
+        }
+    }
+
+    void testBuilderGapsAndEnds()
+    {
+        /* Data only around 25 °C and 40 °C: bins between are interpolated, bins outside held flat */
+        TempBiasBuilder builder(20.0f, 2.5f);
+        logRamp(builder, 24.0f, 26.0f);
+        logRamp(builder, 39.0f, 41.0f);
+
+        TempBiasTable table;
+        CHECK(builder.build(table));
+        for (uint8_t i = 2; i <= 8; i++)
+        {
+            CHECK_NEAR(table.bias[TC_GYRO_X][i], 25 * i, 1);
+        }
+        CHECK(table.bias[TC_GYRO_X][0] == table.bias[TC_GYRO_X][2]);
+        CHECK(table.bias[TC_GYRO_X][1] == table.bias[TC_GYRO_X][2]);
+        CHECK(table.bias[TC_GYRO_X][TEMP_COMP_POINTS - 1] == table.bias[TC_GYRO_X][8]);
+    }
+
+    void testBuilderSingleBinAndEmpty()
+    {
+        TempBiasBuilder builder(20.0f, 5.0f);
+        TempBiasTable table;
+        CHECK(!builder.build(table));
+
+        logRamp(builder, 29.0f, 31.0f);
+        CHECK(builder.build(table));
+        for (uint8_t i = 0; i < TEMP_COMP_POINTS; i++)
+        {
+            CHECK_NEAR(table.bias[TC_GYRO_X][i], 100, 1);
+        }
+
+        builder.reset();
+        CHECK(!builder.build(table));
+    }
+}
+
+int main()
+{
+    testBuilderRamp();
+    testBuilderGapsAndEnds();
+    testBuilderSingleBinAndEmpty();
+    testInterpolation();
+    testDeadband();
+    testCorrection();
+    return testResult("test_tempcomp");
+}
@@ -0,0 +1,270 @@
+/**
+ * @file  :test_vibration.cpp
+ * @brief :VibrationAnalyzer (Q15 FFT) against a double-precision DFT of the same window.
+ *
+ * The reference applies a continuous Hann window to the mean-removed samples,
+ * takes a direct DFT in double and accumulates the one-sided mean square per
+ * band exactly as documented in MPU9250_Vibration.hpp. Large signals exercise
+ * the down-shift path of the block scaling, small ones the up-shift path.
+ * The analyzer must leave SysTick to the CycleCounter its caller controls.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_Vibration.hpp"
+#include "hardware/structs/systick.h"
+#include "test_common.hpp"
+#include <cstdint>
+#include <random>
+
+namespace
+{
+    constexpr double PI          = 3.14159265358979323846;
+    constexpr float  SAMPLE_RATE = 1000.0f;
+    constexpr float  ACCEL_SCALE = 1.0f / 16384.0f;
+    constexpr uint8_t BANDS      = 5;
+    constexpr float  EDGES[BANDS + 1] = { 5.0f, 40.0f, 75.0f, 150.0f, 300.0f, 500.0f };
+
+    struct Reference
+    {
+        double bandEnergy_g2[VIB_MAX_BANDS];
+        double total_g2;
+        double peakFreq_hz;
+    };
+
+    Reference dftReference(const int16_t *x)
+    {
+        const int N = VIB_FFT_SIZE;
+
+        double mean = 0.0;
+        for (int n = 0; n < N; n++)
+        {
+            mean += x[n];
+        }
+        mean /= N;
+
+        double w[VIB_FFT_SIZE];
+        double windowPower = 0.0;
+        for (int n = 0; n < N; n++)
+        {
+            w[n] = 0.5 - 0.5 * std::cos(2.0 * PI * n / N);
+            windowPower += w[n] * w[n];
+        }
+        windowPower /= N;
+
+        Reference ref = {};
+        double peakPower = 0.0;
+        for (int k = 1; k <= N / 2; k++)
+        {
+            double re = 0.0;
+            double im = 0.0;
+            for (int n = 0; n < N; n++)
+            {
+                const double v = (x[n] - mean) * w[n];
+                re += v * std::cos(2.0 * PI * k * n / N);
+                im -= v * std::sin(2.0 * PI * k * n / N);
+            }
+            double power = re * re + im * im;
+            if (power > peakPower)
+            {
+                peakPower       = power;
+                ref.peakFreq_hz = k * (double)SAMPLE_RATE / N;
+            }
+            if (k == N / 2)
+            {
+                power *= 0.5;
+            }
+
+            const double energy = 2.0 * power / ((double)N * N * windowPower) * ACCEL_SCALE * ACCEL_SCALE;
+            ref.total_g2 += energy;
+
+            const double f = k * (double)SAMPLE_RATE / N;
+            for (uint8_t b = 0; b < BANDS; b++)
+            {
+                if ((f >= EDGES[b]) && (f < EDGES[b + 1]))
+                {
+                    ref.bandEnergy_g2[b] += energy;
+                }
+            }
+        }
+        return ref;
+    }
+
+    VibrationConfig makeConfig()
+    {
+        VibrationConfig cfg = {};
+        cfg.sampleRate_hz = SAMPLE_RATE;
+        cfg.hop           = VIB_FFT_SIZE / 2;
+        cfg.accelScale    = ACCEL_SCALE;
+        cfg.bandCount     = BANDS;
+        for (uint8_t b = 0; b <= BANDS; b++)
+        {
+            cfg.bandEdges_hz[b] = EDGES[b];
+        }
+        return cfg;
+    }
+
+    /* Two tones plus noise on a 1 g offset; amplitudes in LSB */
+    void makeSignal(int16_t *out, size_t count, double a1, double f1, double a2, double f2, double noise, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::normal_distribution<double> gauss(0.0, noise);
+        for (size_t n = 0; n < count; n++)
+        {
+            const double t = n / (double)SAMPLE_RATE;
+            const double v = 16384.0 + a1 * std::sin(2.0 * PI * f1 * t) + a2 * std::sin(2.0 * PI * f2 * t + 0.3) +
+                             ((noise > 0.0) ? gauss(rng) : 0.0);
+            out[n] = (int16_t)std::lround(v);
+        }
+    }
+
+    /* Push the signal and compare every completed window against the reference */
+    void checkAgainstDft(const char *name, const int16_t *signal, size_t count)
+    {
+        VibrationAnalyzer analyzer(makeConfig());
+        size_t windows  = 0;
+        double worstRel = 0.0;
+
+        for (size_t n = 0; n < count; n++)
+        {
+            if (!analyzer.pushSample(signal[n]))
+            {
+                continue;
+            }
+            windows++;
+
+            const Reference ref = dftReference(&signal[n + 1 - VIB_FFT_SIZE]);
+            const VibrationResult &res = analyzer.result();
+
+            CHECK(res.sequence == windows);
+            CHECK_NEAR(res.peakFreq_hz, ref.peakFreq_hz, 1e-3);
+
+            double total = 0.0;
+            for (uint8_t b = 0; b < BANDS; b++)
+            {
+                total += res.bandEnergy_g2[b];
+                /* Relative to the window's total energy, so near-empty bands are not judged on noise */
+                const double rel = std::fabs(res.bandEnergy_g2[b] - ref.bandEnergy_g2[b]) / ref.total_g2;
+                if (rel > worstRel)
+                {
+                    worstRel = rel;
+                }
+                CHECK(rel < 1e-3);
+            }
+        }
+
+        std::printf("%-24s windows %zu, worst band error %.5f%% of total energy\n", name, windows, worstRel * 100.0);
+        CHECK(windows == (count - VIB_FFT_SIZE) / (VIB_FFT_SIZE / 2) + 1);
+    }
+
+    void testLargeSignal()
+    {
+        static int16_t signal[VIB_FFT_SIZE * 4];
+        makeSignal(signal, VIB_FFT_SIZE * 4, 6000.0, 62.5, 1500.0, 187.5, 40.0, 1);
+        checkAgainstDft("large (down-shift)", signal, VIB_FFT_SIZE * 4);
+    }
+
+    void testSmallSignal()
+    {
+        /* Windowed peak far below 2^13: the block scaling shifts negative values up */
+        static int16_t signal[VIB_FFT_SIZE * 4];
+        makeSignal(signal, VIB_FFT_SIZE * 4, 60.0, 101.0, 20.0, 333.0, 2.0, 2);
+        checkAgainstDft("small (up-shift)", signal, VIB_FFT_SIZE * 4);
+    }
+
+    void testSingleToneEnergy()
+    {
+        /* On-bin tone of amplitude A has mean square A^2 / 2 */
+        static int16_t signal[VIB_FFT_SIZE];
+        const double amplitude = 4096.0;
+        makeSignal(signal, VIB_FFT_SIZE, amplitude, 125.0, 0.0, 0.0, 0.0, 3);
+
+        VibrationAnalyzer analyzer(makeConfig());
+        CHECK(analyzer.pushBlock(signal, VIB_FFT_SIZE) == 1);
+
+        const double expected = 0.5 * (amplitude * ACCEL_SCALE) * (amplitude * ACCEL_SCALE);
+        CHECK_NEAR(analyzer.result().bandEnergy_g2[2], expected, expected * 1e-3);
+        CHECK_NEAR(analyzer.result().peakFreq_hz, 125.0, 1e-3);
+        CHECK_NEAR(analyzer.result().rms_g, amplitude * ACCEL_SCALE / std::sqrt(2.0), 1e-4);
+    }
+
+    void testSilence()
+    {
+        static int16_t signal[VIB_FFT_SIZE];
+        for (int16_t &s : signal)
+        {
+            s = 16384;
+        }
+        VibrationAnalyzer analyzer(makeConfig());
+        CHECK(analyzer.pushBlock(signal, VIB_FFT_SIZE) == 1);
+        for (uint8_t b = 0; b < BANDS; b++)
+        {
+            CHECK(analyzer.result().bandEnergy_g2[b] == 0.0f);
+        }
+        CHECK(analyzer.result().rms_g == 0.0f);
+    }
+
+    bool sysTickIs(uint32_t csr, uint32_t rvr)
+    {
+        return (systick_hw->csr == csr) && (systick_hw->rvr == rvr);
+    }
+
+    void testSysTickOwnership()
+    {
+        static int16_t signal[VIB_FFT_SIZE];
+
+        /* An RTOS-style tick: 1 ms reload with its interrupt enabled */
+        *systick_hw = { 0x7, 124999, 500, 0 };
+        {
+            VibrationAnalyzer analyzer(makeConfig());
+            CHECK(analyzer.pushBlock(signal, VIB_FFT_SIZE) == 1);
+            CHECK(sysTickIs(0x7, 124999));
+
+            CycleCounter counter;
+            CHECK(!counter.start());
+            CHECK(!counter.running());
+            analyzer.setCycleCounter(&counter);
+            CHECK(analyzer.pushBlock(signal, VIB_FFT_SIZE / 2) == 1);
+            CHECK(analyzer.result().windowCycles == 0);
+            CHECK(sysTickIs(0x7, 124999));
+        }
+        CHECK(sysTickIs(0x7, 124999));
+
+        /* Idle SysTick: claimed for the measurement, then put back */
+        *systick_hw = { 0x0, 0x1234, 0, 0 };
+        {
+            CycleCounter counter;
+            CHECK(counter.start());
+            CHECK(sysTickIs(0x5, CYCLE_COUNTER_MASK));
+            counter.stop();
+            CHECK(sysTickIs(0x0, 0x1234));
+
+            CHECK(counter.start());
+        }
+        CHECK(sysTickIs(0x0, 0x1234));  // released by the destructor
+
+        /* Already free running without interrupt: shared, left running */
+        *systick_hw = { 0x5, CYCLE_COUNTER_MASK, 0, 0 };
+        {
+            CycleCounter counter;
+            CHECK(counter.start());
+            counter.stop();
+            CHECK(sysTickIs(0x5, CYCLE_COUNTER_MASK));
+        }
+        CHECK(CycleCounter::elapsed(10, 0x00FFFFF0u) == 26);  // across the reload
+        *systick_hw = { 0, 0, 0, 0 };
+    }
+}
+
+int main()
+{
+    testLargeSignal();
+    testSmallSignal();
+    testSingleToneEnergy();
+    testSilence();
+    testSysTickOwnership();
+    return testResult("test_vibration");
+}
@@ -0,0 +1,250 @@
+/**
+ * @file  :test_wake_on_motion.cpp
+ * @brief :WakeOnMotionEngine against a simulated MPU9250 with a WOM comparator.
+ *
+ * Runs CYCLING -> ACTIVE -> CYCLING on the simulated clock, with the wake
+ * coming from the fake device's INT pin (or from polling INT_STATUS), and
+ * checks the registers the HAL leaves behind in each state, the wake/sleep
+ * counters, the latency figures and the duty cycle.
+ *
+ * @author  :[Hager Shohieb, Sara Saad]
+ * @version :1.0
+ * @date    :December 01, 2025
+ *
+ * */
+
+#include "MPU9250_WakeOnMotion.hpp"
+#include "fake_mpu9250.hpp"
+#include "test_common.hpp"
+
+using namespace MPU9250Reg;
+
+namespace
+{
+    constexpr uint     INT_GPIO = 15;
+    constexpr uint32_t STEP_US  = 10000;  // main loop period
+
+    const AccelData STILL  = { 0.0f, 0.0f, 1.0f };
+    const AccelData MOVING = { 0.3f, 0.0f, 1.0f };  // energy 0.09
+    const GyroData  NO_ROTATION = { 0.0f, 0.0f, 0.0f };
+
+    WakeOnMotionConfig makeConfig()
+    {
+        WakeOnMotionConfig cfg = {};
+        cfg.threshold_mg   = 100;
+        cfg.wakeRate       = LpAccelOdr::HZ_31_25;
+        cfg.quietEnergy    = 0.02f;
+        cfg.gyroWeight     = 1e-5f;
+        cfg.quietPeriod_us = 2000000;
+        return cfg;
+    }
+
+    uint32_t step()
+    {
+        HostShim::advance_us(STEP_US);
+        return time_us_32();
+    }
+
+    void checkCycling(const FakeMpu9250 &dev, uint8_t intPinCfg)
+    {
+        CHECK(dev.womArmed());
+        CHECK(dev.regs[PWR_MGMT_1::address] == 0x21);
+        CHECK(dev.regs[WOM_THR::address] == 25);
+        CHECK(dev.regs[LP_ACCEL_ODR::address] == (uint8_t)LpAccelOdr::HZ_31_25);
+        CHECK(dev.regs[INT_PIN_CFG::address] == intPinCfg);
+        CHECK(!dev.intHigh());
+    }
+
+    void checkActive(const FakeMpu9250 &dev, uint8_t intPinCfg)
+    {
+        CHECK(!dev.womArmed());
+        CHECK(dev.regs[PWR_MGMT_1::address] == 0x01);
+        CHECK(dev.regs[PWR_MGMT_2::address] == 0x00);
+        CHECK(dev.regs[INT_ENABLE::address] == 0x00);
+        CHECK(dev.regs[MOT_DETECT_CTRL::address] == 0x00);
+        CHECK(dev.regs[INT_PIN_CFG::address] == intPinCfg);
+        CHECK(dev.regs[ACCEL_CONFIG2::address] == 0x03);  // configuration shadow back
+        CHECK(!dev.intHigh());
+    }
+
+    /* Motion interrupt while cycling; returns the poll time of the wake */
+    uint32_t wake(WakeOnMotionEngine &wom, FakeMpu9250 &dev, uint32_t delay_us)
+    {
+        const uint32_t irqAt = time_us_32();
+        CHECK(dev.motion(300));
+        CHECK(dev.intHigh());
+        CHECK(!dev.motion(300));  // already latched, no second edge
+
+        HostShim::advance_us(delay_us);
+        const uint32_t now = time_us_32();
+        CHECK(wom.poll(now));
+        CHECK(wom.state() == WomState::ACTIVE);
+
+        /* Latency runs from the edge to the end of the exit transaction */
+        CHECK(wom.lastWakeLatency_us() == time_us_32() - irqAt);
+        CHECK(wom.lastWakeLatency_us() >= delay_us);
+        CHECK(wom.lastWakeLatency_us() < delay_us + 1000);
+        return now;
+    }
+
+    /* Move for moving_us, then hold still until the engine drops back; returns the poll time of the sleep */
+    uint32_t runActive(WakeOnMotionEngine &wom, FakeMpu9250 &dev, uint32_t moving_us)
+    {
+        const uint32_t start      = time_us_32();
+        uint32_t       lastMoving = start;
+        for (;;)
+        {
+            const uint32_t now    = step();
+            const bool     moving = (now - start) < moving_us;
+            wom.reportSample(moving ? MOVING : STILL, NO_ROTATION, now);
+            if (moving)
+            {
+                lastMoving = now;
+            }
+            CHECK(!dev.motion(300));  // comparator is off at full rate
+
+            if (wom.poll(now))
+            {
+                CHECK(wom.state() == WomState::CYCLING);
+                CHECK((now - lastMoving) >= 2000000);
+                CHECK((now - lastMoving) < 2000000 + STEP_US);
+                return now;
+            }
+            CHECK(wom.state() == WomState::ACTIVE);
+            CHECK(wom.gyroSettled(now) == ((now - start) >= WOM_GYRO_SETTLE_US));
+        }
+    }
+
+    void testInterruptDriven()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev(INT_GPIO);
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+
+        WakeOnMotionEngine wom(hal, makeConfig());
+        wom.attachInterrupt(INT_GPIO);
+        CHECK(wom.state() == WomState::IDLE);
+
+        const uint32_t began = time_us_32();
+        CHECK(wom.begin(began));
+        CHECK(wom.state() == WomState::CYCLING);
+        checkCycling(dev, 0x20);
+
+        /* Below threshold: no edge, and no bus traffic while waiting on the GPIO */
+        const uint32_t transfers = HostShim::i2cTransfers();
+        for (int i = 0; i < 100; i++)
+        {
+            CHECK(!dev.motion(80));
+            CHECK(!wom.poll(step()));
+        }
+        CHECK(HostShim::i2cTransfers() == transfers);
+        CHECK(wom.wakes() == 0);
+
+        uint64_t active_us = 0;
+        const uint32_t woke1 = wake(wom, dev, 2000);
+        checkActive(dev, 0x00);
+        const uint32_t slept1 = runActive(wom, dev, 3000000);
+        active_us += slept1 - woke1;
+        checkCycling(dev, 0x20);
+
+        for (int i = 0; i < 500; i++)
+        {
+            CHECK(!wom.poll(step()));
+        }
+
+        const uint32_t woke2 = wake(wom, dev, 7000);
+        checkActive(dev, 0x00);
+        const uint32_t slept2 = runActive(wom, dev, 0);
+        active_us += slept2 - woke2;
+        checkCycling(dev, 0x20);
+
+        const uint32_t end = step();
+        CHECK(!wom.poll(end));
+
+        CHECK(wom.wakes() == 2);
+        CHECK(wom.sleeps() == 2);
+        CHECK(wom.maxWakeLatency_us() >= 7000);
+        CHECK(wom.meanWakeLatency_us() >= 4500);
+        CHECK(wom.meanWakeLatency_us() < wom.maxWakeLatency_us());
+        CHECK_NEAR(wom.dutyCycle(), (double)active_us / (double)(end - began), 1e-6);
+
+        /* The MPU9250 never had its aux bus bypass enabled behind the application's back */
+        CHECK((dev.bitsWritten(INT_PIN_CFG::address) & INT_PIN_CFG::BYPASS_EN.mask) == 0);
+
+        std::printf("wake latency mean %u us, max %u us; duty cycle %.3f\n",
+                    wom.meanWakeLatency_us(), wom.maxWakeLatency_us(), wom.dutyCycle());
+    }
+
+    void testBypassPreserved()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev(INT_GPIO);
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+        CHECK(hal.initAK8963());
+        CHECK(dev.regs[INT_PIN_CFG::address] == 0x02);
+
+        /* An application that enabled bypass for the magnetometer keeps it across a wake/sleep cycle */
+        WakeOnMotionEngine wom(hal, makeConfig());
+        wom.attachInterrupt(INT_GPIO);
+        CHECK(wom.begin(time_us_32()));
+        checkCycling(dev, 0x22);
+        wake(wom, dev, 1000);
+        checkActive(dev, 0x02);
+        runActive(wom, dev, 100000);
+        checkCycling(dev, 0x22);
+    }
+
+    void testPolledStatus()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+
+        /* No GPIO attached: poll() reads INT_STATUS itself */
+        WakeOnMotionEngine wom(hal, makeConfig());
+        CHECK(wom.begin(time_us_32()));
+        for (int i = 0; i < 10; i++)
+        {
+            CHECK(!wom.poll(step()));
+        }
+
+        dev.motion(300);
+        CHECK(dev.regs[INT_STATUS::address] == INT_STATUS::WOM_INT.mask);
+        const uint32_t now = step();
+        CHECK(wom.poll(now));
+        CHECK(wom.state() == WomState::ACTIVE);
+        CHECK(wom.wakes() == 1);
+        CHECK(wom.lastWakeLatency_us() == time_us_32() - now);
+        checkActive(dev, 0x00);
+    }
+
+    void testBusFailure()
+    {
+        HostShim::reset();
+        FakeMpu9250 dev;
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, &dev);
+        MPU9250_HAL hal(i2c_default, MPU6500_DEFAULT_ADDRESS);
+        CHECK(hal.begin(PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN, 400000));
+
+        HostShim::attach(MPU6500_DEFAULT_ADDRESS, nullptr);
+        WakeOnMotionEngine wom(hal, makeConfig());
+        CHECK(!wom.begin(time_us_32()));
+        CHECK(wom.state() == WomState::FAILED);
+        CHECK(!wom.poll(step()));
+    }
+}
+
+int main()
+{
+    testInterruptDriven();
+    testBypassPreserved();
+    testPolledStatus();
+    testBusFailure();
+    return testResult("test_wake_on_motion");
+}